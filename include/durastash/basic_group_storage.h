@@ -0,0 +1,544 @@
+#pragma once
+
+#include "durastash/types.h"
+#include "durastash/ulid.h"
+#include "durastash/errors.h"
+#include "durastash/storage.h"
+#include "durastash/key_format.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+
+namespace durastash {
+
+// ============================================================================
+// 백엔드 정책
+// ============================================================================
+//
+// BasicGroupStorage가 요구하는 백엔드 연산 (모두 비가상 멤버)
+//   bool Put(std::string_view key, std::string_view value)
+//   bool Get(std::string_view key, std::string& value)
+//   bool Delete(std::string_view key)
+//   bool DeleteRange(std::string_view start_key, std::string_view end_key)
+//   void Scan(std::string_view lower, std::string_view upper, Visitor&& visit)
+//       visit(key, value)가 false를 반환하면 중단
+//   bool Atomically(Fn&& fn)
+//       fn 안에서 수행한 쓰기를 원자적으로 반영 (fn이 false면 반영하지 않음)
+
+/**
+ * 메모리 백엔드 (std::map 기반, 영속성 없음)
+ * 임베더 테스트나 휘발성 큐 용도. 호출자(BasicGroupStorage의 잠금 정책)가 동기화 담당
+ */
+class MemoryBackend {
+public:
+    bool Put(std::string_view key, std::string_view value) {
+        auto it = data_.lower_bound(key);
+        if (it != data_.end() && it->first == key) {
+            it->second.assign(value.data(), value.size());
+        } else {
+            data_.emplace_hint(it, std::string(key), std::string(value));
+        }
+        return true;
+    }
+
+    bool Get(std::string_view key, std::string& value) {
+        auto it = data_.find(key);
+        if (it == data_.end()) {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    bool Delete(std::string_view key) {
+        auto it = data_.find(key);
+        if (it != data_.end()) {
+            data_.erase(it);
+        }
+        return true;
+    }
+
+    bool DeleteRange(std::string_view start_key, std::string_view end_key) {
+        data_.erase(data_.lower_bound(start_key), data_.lower_bound(end_key));
+        return true;
+    }
+
+    template <typename Visitor>
+    void Scan(std::string_view lower, std::string_view upper, Visitor&& visit) {
+        for (auto it = data_.lower_bound(lower); it != data_.end() && it->first < upper; ++it) {
+            if (!visit(std::string_view(it->first), std::string_view(it->second))) {
+                break;
+            }
+        }
+    }
+
+    template <typename Fn>
+    bool Atomically(Fn&& fn) {
+        // 메모리 쓰기는 실패하지 않으며 잠금 정책 아래에서 실행되므로 그대로 실행
+        return fn();
+    }
+
+    /**
+     * 저장된 키 수
+     */
+    size_t Size() const {
+        return data_.size();
+    }
+
+private:
+    std::map<std::string, std::string, std::less<>> data_;
+};
+
+/**
+ * IStorage 백엔드 (가상 호출로 기존 저장소 구현체 사용, 예: RocksDBStorage)
+ * 저장소는 초기화된 상태로 전달해야 하며, 이 백엔드보다 오래 유지되어야 함
+ */
+class StorageBackend {
+public:
+    explicit StorageBackend(IStorage& storage) : storage_(storage) {}
+
+    bool Put(std::string_view key, std::string_view value) {
+        if (in_batch_) {
+            storage_.PutToBatch(key, value);
+            return true;
+        }
+        return storage_.Put(key, value);
+    }
+
+    bool Get(std::string_view key, std::string& value) {
+        return storage_.Get(key, value);
+    }
+
+    bool Delete(std::string_view key) {
+        if (in_batch_) {
+            storage_.DeleteFromBatch(key);
+            return true;
+        }
+        return storage_.Delete(key);
+    }
+
+    bool DeleteRange(std::string_view start_key, std::string_view end_key) {
+        if (in_batch_) {
+            storage_.DeleteRangeFromBatch(start_key, end_key);
+            return true;
+        }
+        return storage_.DeleteRange(start_key, end_key);
+    }
+
+    template <typename Visitor>
+    void Scan(std::string_view lower, std::string_view upper, Visitor&& visit) {
+        std::string lower_key(lower);
+        auto cursor = storage_.NewCursor(lower_key, std::string(upper));
+        if (!cursor) {
+            return;
+        }
+        for (cursor->Seek(lower_key); cursor->Valid(); cursor->Next()) {
+            if (!visit(cursor->Key(), cursor->Value())) {
+                break;
+            }
+        }
+    }
+
+    template <typename Fn>
+    bool Atomically(Fn&& fn) {
+        if (!storage_.BeginBatch()) {
+            return false;
+        }
+        in_batch_ = true;
+        bool ok = fn();
+        in_batch_ = false;
+        if (!ok) {
+            storage_.RollbackBatch();
+            return false;
+        }
+        return storage_.CommitBatch();
+    }
+
+    IStorage& GetStorage() {
+        return storage_;
+    }
+
+private:
+    IStorage& storage_;
+    bool in_batch_ = false;
+};
+
+// ============================================================================
+// 메타데이터 코덱 정책
+// ============================================================================
+//
+//   static void Encode(BatchMetadata& metadata, std::string& out)
+//   static bool Decode(std::string_view bytes, BatchMetadata& metadata)
+
+/**
+ * JSON 코덱 (GroupStorage와 같은 배치 메타데이터 형식)
+ */
+struct JsonMetadataCodec {
+    static void Encode(BatchMetadata& metadata, std::string& out) {
+        out = metadata.toJson();
+    }
+
+    static bool Decode(std::string_view bytes, BatchMetadata& metadata) {
+        try {
+            metadata.fromJson(std::string(bytes));
+        } catch (...) {
+            return false;
+        }
+        return !metadata.GetBatchId().empty();
+    }
+};
+
+/**
+ * 고정 길이 바이너리 코덱 (JSON 파싱 없이 memcpy로 인코딩/디코딩)
+ * 형식: batch_id(26) + sequence_start(8) + sequence_end(8) + created_at(8) + loaded_at(8) + status(1)
+ * 정수는 호스트 바이트 순서. 세그먼트/체크섬 필드는 저장하지 않음
+ */
+struct BinaryMetadataCodec {
+    static constexpr size_t BATCH_ID_SIZE = 26;
+    static constexpr size_t ENCODED_SIZE = BATCH_ID_SIZE + 4 * sizeof(int64_t) + 1;
+
+    static void Encode(BatchMetadata& metadata, std::string& out) {
+        out.resize(ENCODED_SIZE);
+        char* p = out.data();
+        const std::string& batch_id = metadata.GetBatchId();
+        std::memset(p, 0, BATCH_ID_SIZE);
+        std::memcpy(p, batch_id.data(), batch_id.size() < BATCH_ID_SIZE ? batch_id.size() : BATCH_ID_SIZE);
+        p += BATCH_ID_SIZE;
+        p = Write(p, metadata.GetSequenceStart());
+        p = Write(p, metadata.GetSequenceEnd());
+        p = Write(p, metadata.GetCreatedAt());
+        p = Write(p, metadata.GetLoadedAt());
+        *p = static_cast<char>(metadata.GetStatus());
+    }
+
+    static bool Decode(std::string_view bytes, BatchMetadata& metadata) {
+        if (bytes.size() != ENCODED_SIZE) {
+            return false;
+        }
+        const char* p = bytes.data();
+        std::string_view batch_id(p, BATCH_ID_SIZE);
+        size_t end = batch_id.find('\0');
+        if (end == 0) {
+            return false;
+        }
+        metadata.SetBatchId(std::string(batch_id.substr(0, end)));
+        p += BATCH_ID_SIZE;
+        metadata.SetSequenceStart(Read(p));
+        metadata.SetSequenceEnd(Read(p + 8));
+        metadata.SetCreatedAt(Read(p + 16));
+        metadata.SetLoadedAt(Read(p + 24));
+        uint8_t status = static_cast<uint8_t>(p[32]);
+        if (status > static_cast<uint8_t>(BatchStatus::ACKNOWLEDGED)) {
+            return false;
+        }
+        metadata.SetStatus(static_cast<BatchStatus>(status));
+        return true;
+    }
+
+private:
+    static char* Write(char* p, int64_t value) {
+        std::memcpy(p, &value, sizeof(value));
+        return p + sizeof(value);
+    }
+
+    static int64_t Read(const char* p) {
+        int64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+};
+
+// ============================================================================
+// 잠금 정책
+// ============================================================================
+
+/**
+ * 뮤텍스 잠금 (여러 스레드에서 공유)
+ */
+class MutexLockPolicy {
+public:
+    void lock() { mutex_.lock(); }
+    void unlock() { mutex_.unlock(); }
+
+private:
+    std::mutex mutex_;
+};
+
+/**
+ * 잠금 없음 (단일 스레드 전용, 잠금 호출이 인라인되어 사라짐)
+ */
+class NullLockPolicy {
+public:
+    void lock() {}
+    void unlock() {}
+};
+
+/**
+ * 컴파일 타임 정책 기반 그룹 저장소
+ *
+ * 백엔드/코덱/잠금을 템플릿 인자로 받아 저장소 호출부터 메타데이터 인코딩까지
+ * 가상 호출 없이 인라인될 수 있도록 한 헤더 전용 구현.
+ * GroupStorage와 같은 키 레이아웃(세션/배치 메타데이터/20자리 시퀀스 데이터 키)과
+ * 정렬된 배치 범위를 사용하며, Save/Load/LoadBatch/AcknowledgeBatch의 핵심 큐 기능만 제공
+ * (중복 제거, 체크섬, 콜드 티어, 세션 상태 기록 등은 GroupStorage에서만 지원)
+ *
+ * @tparam Backend 백엔드 정책 (MemoryBackend, StorageBackend 등)
+ * @tparam Codec 메타데이터 코덱 정책 (JsonMetadataCodec, BinaryMetadataCodec)
+ * @tparam LockPolicy 잠금 정책 (MutexLockPolicy, NullLockPolicy)
+ */
+template <typename Backend, typename Codec = JsonMetadataCodec, typename LockPolicy = MutexLockPolicy>
+class BasicGroupStorage {
+public:
+    /**
+     * 생성자
+     * @param args 백엔드 생성자 인자
+     */
+    template <typename... Args>
+    explicit BasicGroupStorage(Args&&... args) : backend_(std::forward<Args>(args)...) {}
+
+    BasicGroupStorage(const BasicGroupStorage&) = delete;
+    BasicGroupStorage& operator=(const BasicGroupStorage&) = delete;
+
+    /**
+     * 세션 초기화 (새 세션 시작, 이전 세션 데이터는 Load 대상에서 제외)
+     * @param group_key 그룹 키
+     * @return 성공시 true
+     */
+    bool InitializeSession(const std::string& group_key) {
+        std::lock_guard<LockPolicy> lock(lock_);
+        StartSession(groups_[group_key], group_key);
+        return true;
+    }
+
+    /**
+     * 데이터 저장 (세션이 없으면 생성)
+     * @param group_key 그룹 키
+     * @param data 데이터
+     * @return 성공시 true
+     */
+    bool Save(const std::string& group_key, std::string_view data) {
+        std::lock_guard<LockPolicy> lock(lock_);
+
+        GroupState& state = GetOrCreateState(group_key);
+        int64_t sequence_id = state.next_sequence++;
+        int64_t batch_start = (sequence_id / batch_size_) * batch_size_;
+
+        if (batch_start == state.batch_start) {
+            MakeDataKey(state, state.batch_id, sequence_id);
+            return backend_.Put(key_buffer_, data);
+        }
+
+        // 새 배치: 메타데이터와 첫 데이터를 함께 반영
+        BatchMetadata metadata;
+        metadata.SetBatchId(ULID::GenerateMonotonic());
+        metadata.SetSequenceStart(batch_start);
+        metadata.SetSequenceEnd(batch_start + batch_size_ - 1);
+        metadata.SetStatus(BatchStatus::PENDING);
+        metadata.SetCreatedAt(static_cast<int64_t>(ULID::Now()));
+        Codec::Encode(metadata, value_buffer_);
+
+        std::string metadata_key = state.prefix + kBatchInfix + metadata.GetBatchId();
+        MakeDataKey(state, metadata.GetBatchId(), sequence_id);
+        bool written = backend_.Atomically([&]() {
+            return backend_.Put(metadata_key, value_buffer_) && backend_.Put(key_buffer_, data);
+        });
+        if (!written) {
+            return false;
+        }
+
+        state.batch_start = batch_start;
+        state.batch_id = metadata.GetBatchId();
+        return true;
+    }
+
+    /**
+     * 기본 로드 (상태 변경 없음, 현재 세션의 모든 데이터를 FIFO 순서로 반환)
+     * @param group_key 그룹 키
+     * @return 데이터 목록
+     */
+    std::vector<std::string> Load(const std::string& group_key) {
+        std::lock_guard<LockPolicy> lock(lock_);
+
+        std::vector<std::string> results;
+        auto it = groups_.find(group_key);
+        if (it == groups_.end()) {
+            return results;
+        }
+
+        // 데이터 키의 배치 ID(ULID)는 'a'보다 작고 메타데이터 키("batch:")는 'b'로 시작하므로
+        // [prefix, prefix + "a") 범위가 정확히 데이터 키이며, 키 순서가 생성 순서와 일치
+        const std::string& prefix = it->second.prefix;
+        backend_.Scan(prefix, prefix + "a", [&](std::string_view, std::string_view value) {
+            results.emplace_back(value);
+            return true;
+        });
+        return results;
+    }
+
+    /**
+     * 배치 단위 로드 (PENDING → LOADED)
+     * @param group_key 그룹 키
+     * @param batch_size 최대 배치 수
+     * @return 배치 로드 결과 목록
+     */
+    std::vector<BatchLoadResult> LoadBatch(const std::string& group_key, size_t batch_size) {
+        std::lock_guard<LockPolicy> lock(lock_);
+
+        std::vector<BatchLoadResult> results;
+        auto it = groups_.find(group_key);
+        if (it == groups_.end() || batch_size == 0) {
+            return results;
+        }
+
+        // 배치 ID가 단조 증가 ULID이므로 메타데이터 키 순서가 곧 FIFO 순서
+        const std::string& prefix = it->second.prefix;
+        std::vector<BatchMetadata> pending;
+        std::string metadata_prefix = prefix + kBatchInfix;
+        backend_.Scan(metadata_prefix, prefix + "batch;", [&](std::string_view key, std::string_view value) {
+            BatchMetadata metadata;
+            if (!Codec::Decode(value, metadata)) {
+                throw CorruptedBatchException(std::string(key.substr(metadata_prefix.size())));
+            }
+            if (metadata.GetStatus() == BatchStatus::PENDING) {
+                pending.push_back(std::move(metadata));
+            }
+            return pending.size() < batch_size;
+        });
+
+        for (auto& metadata : pending) {
+            metadata.SetStatus(BatchStatus::LOADED);
+            metadata.SetLoadedAt(static_cast<int64_t>(ULID::Now()));
+            Codec::Encode(metadata, value_buffer_);
+            if (!backend_.Put(metadata_prefix + metadata.GetBatchId(), value_buffer_)) {
+                continue;
+            }
+
+            BatchLoadResult result;
+            result.batch_id = metadata.GetBatchId();
+            result.sequence_start = metadata.GetSequenceStart();
+            result.sequence_end = metadata.GetSequenceEnd();
+            std::string data_prefix = prefix + metadata.GetBatchId() + ":";
+            backend_.Scan(data_prefix, prefix + metadata.GetBatchId() + ";",
+                          [&](std::string_view, std::string_view value) {
+                              result.data.emplace_back(value);
+                              return true;
+                          });
+            results.push_back(std::move(result));
+        }
+        return results;
+    }
+
+    /**
+     * 배치 ACK 및 삭제 (메타데이터 삭제 + 데이터 범위 삭제를 원자적으로 반영)
+     * @param group_key 그룹 키
+     * @param batch_id 배치 ID
+     * @return 성공시 true
+     */
+    bool AcknowledgeBatch(const std::string& group_key, const std::string& batch_id) {
+        std::lock_guard<LockPolicy> lock(lock_);
+
+        auto it = groups_.find(group_key);
+        if (it == groups_.end()) {
+            return false;
+        }
+
+        const std::string& prefix = it->second.prefix;
+        std::string metadata_key = prefix + kBatchInfix + batch_id;
+        if (!backend_.Get(metadata_key, value_buffer_)) {
+            return false;
+        }
+
+        std::string data_prefix = prefix + batch_id;
+        return backend_.Atomically([&]() {
+            return backend_.Delete(metadata_key) &&
+                   backend_.DeleteRange(data_prefix + ":", data_prefix + ";");
+        });
+    }
+
+    /**
+     * 배치 크기 설정 (이후 생성되는 배치부터 적용)
+     * @param batch_size 배치당 시퀀스 수
+     */
+    void SetBatchSize(size_t batch_size) {
+        std::lock_guard<LockPolicy> lock(lock_);
+        if (batch_size > 0) {
+            batch_size_ = static_cast<int64_t>(batch_size);
+        }
+    }
+
+    size_t GetBatchSize() const {
+        return static_cast<size_t>(batch_size_);
+    }
+
+    /**
+     * 현재 세션 ID 조회
+     * @param group_key 그룹 키
+     * @return 세션 ID (세션이 없으면 빈 문자열)
+     */
+    std::string GetSessionId(const std::string& group_key) {
+        std::lock_guard<LockPolicy> lock(lock_);
+        auto it = groups_.find(group_key);
+        return it == groups_.end() ? std::string() : it->second.session_id;
+    }
+
+    /**
+     * 백엔드 직접 접근 (잠금 없이 접근하므로 다른 호출과 동시에 사용하지 말 것)
+     */
+    Backend& GetBackend() {
+        return backend_;
+    }
+
+private:
+    static constexpr const char* kBatchInfix = "batch:";
+
+    struct GroupState {
+        std::string session_id;
+        std::string prefix;          // "group:session:"
+        int64_t next_sequence = 0;
+        int64_t batch_start = -1;    // 현재 열린 배치의 시작 시퀀스 (-1이면 없음)
+        std::string batch_id;
+    };
+
+    Backend backend_;
+    LockPolicy lock_;
+    std::unordered_map<std::string, GroupState> groups_;
+    int64_t batch_size_ = 100;
+    std::string key_buffer_;    // 데이터 키 생성용 재사용 버퍼
+    std::string value_buffer_;  // 메타데이터 인코딩용 재사용 버퍼
+
+    static void StartSession(GroupState& state, const std::string& group_key) {
+        state.session_id = ULID::Generate();
+        state.prefix = group_key + ":" + state.session_id + ":";
+        state.next_sequence = 0;
+        state.batch_start = -1;
+        state.batch_id.clear();
+    }
+
+    GroupState& GetOrCreateState(const std::string& group_key) {
+        GroupState& state = groups_[group_key];
+        if (state.session_id.empty()) {
+            StartSession(state, group_key);
+        }
+        return state;
+    }
+
+    void MakeDataKey(const GroupState& state, const std::string& batch_id, int64_t sequence_id) {
+        key_buffer_.assign(state.prefix);
+        key_buffer_.append(batch_id);
+        key_buffer_.push_back(':');
+        KeyFormat::AppendSequence(key_buffer_, sequence_id);
+    }
+};
+
+/**
+ * IStorage 위의 동적 백엔드 구성 (GroupStorage와 같은 JSON 메타데이터/뮤텍스 잠금)
+ */
+using DynamicGroupStorage = BasicGroupStorage<StorageBackend, JsonMetadataCodec, MutexLockPolicy>;
+
+} // namespace durastash
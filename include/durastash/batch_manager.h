@@ -1,6 +1,7 @@
 #pragma once
 
 #include "durastash/storage.h"
+#include "durastash/dedup_manager.h"
 #include "durastash/types.h"
 #include "durastash/ulid.h"
 #include <string>
@@ -19,6 +20,22 @@ public:
     explicit BatchManager(IStorage* storage);
     ~BatchManager() = default;
 
+    /**
+     * 중복 제거 관리자 설정 (ACK 시 페이로드 참조 해제에 사용)
+     * @param dedup_manager 중복 제거 관리자 (nullptr이면 참조 해제 안 함)
+     */
+    void SetDedupManager(DedupManager* dedup_manager) {
+        dedup_manager_ = dedup_manager;
+    }
+
+    /**
+     * 새 배치의 레코드 체크섬 사용 여부 설정 (배치 메타데이터에 기록됨)
+     * @param enabled 사용 여부
+     */
+    void SetChecksumsEnabled(bool enabled) {
+        checksums_enabled_ = enabled;
+    }
+
     /**
      * 새 배치 생성
      * @param group_key 그룹 키
@@ -32,6 +49,20 @@ public:
                            int64_t sequence_start,
                            int64_t sequence_end);
 
+    /**
+     * 새 배치 생성 (진행 중인 저장소 배치 쓰기에 메타데이터 추가)
+     * BeginBatch 이후 호출해야 하며 커밋은 호출자가 담당
+     * @param group_key 그룹 키
+     * @param session_id 세션 ID
+     * @param sequence_start 시퀀스 시작 번호
+     * @param sequence_end 시퀀스 종료 번호
+     * @return 배치 ID (ULID)
+     */
+    std::string CreateBatchInWriteBatch(const std::string& group_key,
+                                        const std::string& session_id,
+                                        int64_t sequence_start,
+                                        int64_t sequence_end);
+
     /**
      * 배치 메타데이터 조회
      * @param group_key 그룹 키
@@ -61,11 +92,13 @@ public:
      * @param group_key 그룹 키
      * @param session_id 세션 ID
      * @param batch_id 배치 ID
+     * @param deleted_keys 출력 삭제된 키 개수 (메타데이터 포함, nullptr 허용)
      * @return 성공시 true
      */
     bool AcknowledgeBatch(const std::string& group_key,
                          const std::string& session_id,
-                         const std::string& batch_id);
+                         const std::string& batch_id,
+                         size_t* deleted_keys = nullptr);
 
     /**
      * Load 가능한 배치 조회 (FIFO 순서)
@@ -103,6 +136,14 @@ public:
                                      const std::string& session_id,
                                      const std::string& batch_id);
 
+    /**
+     * 데이터 키 생성 (내부 사용)
+     */
+    std::string MakeDataKey(const std::string& group_key,
+                           const std::string& session_id,
+                           const std::string& batch_id,
+                           int64_t sequence_id);
+
     /**
      * sequence_id가 포함된 배치 ID 찾기
      * @param group_key 그룹 키
@@ -127,12 +168,13 @@ public:
 
 private:
     IStorage* storage_;
+    DedupManager* dedup_manager_ = nullptr;
+    bool checksums_enabled_ = false;
     std::mutex mutex_;
 
-    std::string MakeDataKey(const std::string& group_key,
-                           const std::string& session_id,
-                           const std::string& batch_id,
-                           int64_t sequence_id);
+    std::string MakeNewBatchMetadata(const std::string& batch_id,
+                                     int64_t sequence_start,
+                                     int64_t sequence_end);
 };
 
 } // namespace durastash
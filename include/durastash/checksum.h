@@ -0,0 +1,80 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace durastash {
+
+/**
+ * 레코드 무결성 검사용 CRC32C (Castagnoli) 유틸리티
+ *
+ * x86 SSE4.2 / ARMv8 CRC32 명령을 사용할 수 있으면 하드웨어로 계산하고,
+ * 아니면 slicing-by-8 테이블 구현으로 계산 (결과는 동일)
+ */
+class Checksum {
+public:
+    static constexpr size_t RECORD_CHECKSUM_SIZE = 4;
+
+    /**
+     * CRC32C 계산 (이전 결과를 crc로 넘기면 이어서 계산)
+     * @param data 데이터 포인터
+     * @param length 데이터 길이
+     * @param crc 이전 CRC (처음이면 0)
+     * @return CRC32C
+     */
+    static uint32_t Crc32c(const void* data, size_t length, uint32_t crc = 0);
+
+    /**
+     * CRC32C 계산
+     * @param data 데이터
+     * @param crc 이전 CRC (처음이면 0)
+     * @return CRC32C
+     */
+    static uint32_t Crc32c(std::string_view data, uint32_t crc = 0) {
+        return Crc32c(data.data(), data.size(), crc);
+    }
+
+    /**
+     * 테이블 구현으로 CRC32C 계산 (하드웨어 경로 검증/비교용)
+     * @param data 데이터 포인터
+     * @param length 데이터 길이
+     * @param crc 이전 CRC (처음이면 0)
+     * @return CRC32C
+     */
+    static uint32_t Crc32cPortable(const void* data, size_t length, uint32_t crc = 0);
+
+    /**
+     * 하드웨어 CRC32C 명령 사용 여부
+     * @return 사용하면 true
+     */
+    static bool IsHardwareAccelerated();
+
+    /**
+     * 여러 레코드의 CRC32C 일괄 검증
+     * 하드웨어 경로에서는 레코드 3개씩 CRC 명령을 교차 실행해 명령 지연시간을 숨김
+     * @param payloads 페이로드 배열
+     * @param expected 기대 CRC 배열
+     * @param count 레코드 수
+     * @return 첫 번째 불일치 레코드 인덱스 (모두 일치하면 count)
+     */
+    static size_t VerifyBatch(const std::string* payloads, const uint32_t* expected, size_t count);
+
+    /**
+     * 저장 값 끝에 페이로드의 CRC32C 추가 (리틀 엔디언 4바이트)
+     * @param stored_value 저장 값 (페이로드 또는 중복 제거 참조)
+     * @param payload CRC를 계산할 실제 페이로드
+     */
+    static void AppendRecordChecksum(std::string& stored_value, std::string_view payload);
+
+    /**
+     * 저장 값 끝의 CRC32C 분리
+     * @param stored_value 입력 저장 값, 출력 CRC를 제외한 값
+     * @param expected 출력 기대 CRC
+     * @return 성공시 true (값이 CRC보다 짧으면 false)
+     */
+    static bool SplitRecordChecksum(std::string& stored_value, uint32_t& expected);
+};
+
+} // namespace durastash
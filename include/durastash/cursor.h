@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace durastash {
+
+/**
+ * 저장소 커서 인터페이스
+ * 키 순서대로 순방향 순회하는 장기 보유 반복자
+ * 단일 스레드에서만 사용해야 하며, 저장소 종료 전에 해제해야 함
+ */
+class ICursor {
+public:
+    virtual ~ICursor() = default;
+
+    /**
+     * 지정한 키 이상인 첫 위치로 이동
+     * @param key 시작 키
+     */
+    virtual void Seek(const std::string& key) = 0;
+
+    /**
+     * 현재 위치가 유효한지 확인 (범위를 벗어나면 false)
+     * @return 유효하면 true
+     */
+    virtual bool Valid() const = 0;
+
+    /**
+     * 다음 위치로 이동
+     */
+    virtual void Next() = 0;
+
+    /**
+     * 현재 키 (다음 이동 전까지만 유효)
+     */
+    virtual std::string_view Key() const = 0;
+
+    /**
+     * 현재 값 (다음 이동 전까지만 유효)
+     */
+    virtual std::string_view Value() const = 0;
+
+    /**
+     * 커서 생성 이후 추가된 데이터가 보이도록 갱신
+     * 갱신 후에는 위치가 무효화되므로 Seek 필요
+     * @return 성공시 true
+     */
+    virtual bool Refresh() = 0;
+};
+
+} // namespace durastash
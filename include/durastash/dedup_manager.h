@@ -0,0 +1,126 @@
+#pragma once
+
+#include "durastash/storage.h"
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <mutex>
+#include <cstdint>
+
+namespace durastash {
+
+/**
+ * 중복 제거 통계
+ */
+struct DedupStats {
+    uint64_t payload_bytes = 0;        // 중복 제거 대상 페이로드 총 바이트
+    uint64_t stored_bytes = 0;         // 실제로 새로 저장된 페이로드 바이트
+    uint64_t deduplicated_count = 0;   // 기존 페이로드를 참조로 대체한 횟수
+    uint64_t hash_time_ns = 0;         // 해시 계산 누적 시간 (나노초)
+};
+
+/**
+ * 콘텐츠 주소 기반 페이로드 중복 제거 관리자
+ * 
+ * 최소 크기 이상의 페이로드를 콘텐츠 해시 키(__durastash__:blob:<hash>)에 한 번만 저장하고,
+ * 데이터 키에는 해시 참조 값을 저장. 참조 카운트(__durastash__:blobref:<hash>)는
+ * 병합 연산자로 증감하며, ACK 후 0이 된 페이로드는 CollectGarbage에서 삭제됨.
+ * 참조 값은 NUL 바이트로 시작하므로, 활성 시 NUL 바이트로 시작하는 일반 페이로드는
+ * NUL 바이트 하나를 앞에 붙여 저장함 (참조 값과 혼동되지 않도록)
+ */
+class DedupManager {
+public:
+    DedupManager(IStorage* storage, size_t min_size);
+    ~DedupManager() = default;
+
+    /**
+     * 중복 제거 활성 여부
+     * @return 활성시 true
+     */
+    bool IsEnabled() const {
+        return min_size_ > 0;
+    }
+
+    /**
+     * 주어진 크기의 페이로드가 중복 제거 대상인지 확인
+     * @param size 페이로드 크기
+     * @return 대상이면 true
+     */
+    bool ShouldDeduplicate(size_t size) const {
+        return min_size_ > 0 && size >= min_size_;
+    }
+
+    /**
+     * 원본 그대로 저장할 페이로드에 이스케이프 바이트가 필요한지 확인
+     * 필요하면 저장 값 앞에 NUL 바이트 하나를 붙이고, Resolve가 이를 제거함
+     * @param data 페이로드
+     * @return 이스케이프가 필요하면 true (비활성 시 항상 false)
+     */
+    bool NeedsEscape(std::string_view data) const {
+        return min_size_ > 0 && !data.empty() && data.front() == '\0';
+    }
+
+    /**
+     * 페이로드를 진행 중인 배치 쓰기에 추가하고 데이터 키에 저장할 참조 값 반환
+     * 같은 콘텐츠가 이미 저장되어 있으면 참조 카운트만 증가
+     * BeginBatch 이후 호출해야 하며 커밋은 호출자가 담당
+     * @param data 페이로드
+     * @return 데이터 키에 저장할 참조 값
+     */
+    std::string EncodeToBatch(std::string_view data);
+
+    /**
+     * 배치 쓰기 종료 알림 (커밋 또는 롤백 후 호출)
+     * 같은 배치 안에서 이미 본문을 추가한 페이로드 추적을 초기화
+     */
+    void FinishBatch();
+
+    /**
+     * 저장된 값이 해시 참조인지 확인
+     * @param stored_value 데이터 키의 값
+     * @return 참조이면 true
+     */
+    static bool IsReference(const std::string& stored_value);
+
+    /**
+     * 저장 값을 실제 페이로드로 변환 (참조는 본문으로, 이스케이프된 값은 원본으로, 그 외는 그대로 유지)
+     * 비활성 시 저장 값은 항상 원본이므로 변환하지 않음
+     * @param value 입력 저장 값, 출력 페이로드
+     * @return 성공시 true (참조 대상 페이로드가 없으면 false)
+     */
+    bool Resolve(std::string& value);
+
+    /**
+     * 참조 해제를 진행 중인 배치 쓰기에 추가 (참조 카운트 감소)
+     * 참조가 아닌 값은 무시
+     * @param stored_value 삭제될 데이터 키의 값
+     */
+    void ReleaseToBatch(const std::string& stored_value);
+
+    /**
+     * 참조 카운트가 0이 된 페이로드 삭제
+     * 참조 해제 배치가 커밋된 후 호출
+     * @return 삭제된 페이로드 개수
+     */
+    size_t CollectGarbage();
+
+    /**
+     * 중복 제거 통계 반환
+     * @return 통계
+     */
+    DedupStats GetStats() const;
+
+private:
+    IStorage* storage_;
+    size_t min_size_;
+    mutable std::mutex mutex_;
+    std::unordered_set<std::string> released_hashes_;
+    std::unordered_set<std::string> batch_hashes_;   // 커밋 전 배치에 본문이 추가된 해시
+    DedupStats stats_;
+
+    static std::string ComputeContentHash(std::string_view data);
+    static std::string MakeBlobKey(const std::string& content_hash);
+    static std::string MakeRefCountKey(const std::string& content_hash);
+};
+
+} // namespace durastash
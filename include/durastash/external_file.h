@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+namespace durastash {
+
+/**
+ * 외부 정렬 파일 작성기 인터페이스
+ * 저장소에 직접 수집(ingest)할 수 있는 정렬된 키-값 파일 생성
+ * 키는 반드시 오름차순(바이트 비교)으로 추가해야 함
+ */
+class IExternalFileWriter {
+public:
+    virtual ~IExternalFileWriter() = default;
+
+    /**
+     * 파일 생성
+     * @param path 파일 경로
+     * @return 성공시 true
+     */
+    virtual bool Open(const std::string& path) = 0;
+
+    /**
+     * 키-값 추가 (직전 키보다 커야 함)
+     * @param key 키
+     * @param value 값
+     * @return 성공시 true
+     */
+    virtual bool Put(const std::string& key, const std::string& value) = 0;
+
+    /**
+     * 파일 마무리 (항목이 하나도 없으면 실패)
+     * @return 성공시 true
+     */
+    virtual bool Finish() = 0;
+};
+
+} // namespace durastash
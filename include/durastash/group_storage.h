@@ -3,24 +3,26 @@
 #include "durastash/storage.h"
 #include "durastash/session_manager.h"
 #include "durastash/batch_manager.h"
+#include "durastash/dedup_manager.h"
+#include "durastash/stream_consumer.h"
+#include "durastash/options.h"
+#include "durastash/memory_budget.h"
+#include "durastash/payload_arena.h"
 #include <string>
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <string_view>
 #include <unordered_map>
+#include <span>
+#include <utility>
 
 namespace durastash {
 
-/**
- * 배치 로드 결과
- */
-struct BatchLoadResult {
-    std::string batch_id;              // 배치 ID
-    std::vector<std::string> data;      // 데이터 목록
-    int64_t sequence_start;             // 시퀀스 시작
-    int64_t sequence_end;               // 시퀀스 종료
-};
-
 /**
  * 그룹별 저장소 관리자
  * 그룹 키 기반 데이터 분리, FIFO 순서 보장, 배치 단위 처리
@@ -30,8 +32,10 @@ public:
     /**
      * 생성자
      * @param db_path 데이터베이스 경로
+     * @param options 저장소 옵션
      */
-    explicit GroupStorage(const std::string& db_path);
+    explicit GroupStorage(const std::string& db_path,
+                          const StorageOptions& options = StorageOptions());
     
     ~GroupStorage();
 
@@ -41,6 +45,12 @@ public:
      */
     bool Initialize();
 
+    /**
+     * 지연 복구(StorageOptions::lazy_recovery) 완료 대기
+     * 그룹 레지스트리를 메모리로 복구하지 않으므로 항상 즉시 반환
+     */
+    void WaitForRecovery();
+
     /**
      * 저장소 종료
      */
@@ -65,7 +75,37 @@ public:
      * @param data 저장할 데이터
      * @return 성공시 true
      */
-    bool Save(const std::string& group_key, const std::string& data);
+    bool Save(const std::string& group_key, std::string_view data);
+
+    /**
+     * 멱등 저장 (프로듀서 재시도 중복 제거)
+     * 프로듀서별 high-water mark 이하의 producer_seq는 중복으로 간주하여 저장하지 않음
+     * high-water mark는 데이터와 같은 배치로 영속화되며 메모리에 캐시됨 (O(1) 판정)
+     * @param group_key 그룹 키
+     * @param data 저장할 데이터
+     * @param producer_id 프로듀서 ID
+     * @param producer_seq 프로듀서 시퀀스 (프로듀서별 단조 증가)
+     * @return 성공시 true (중복으로 무시된 경우도 true)
+     */
+    bool Save(const std::string& group_key,
+              std::string_view data,
+              const std::string& producer_id,
+              int64_t producer_seq);
+
+    /**
+     * 여러 그룹에 원자적으로 저장 (단일 WriteBatch, 단일 동기 쓰기)
+     * 각 그룹에서 시퀀스를 할당하며, 필요한 새 배치 메타데이터도 같은 커밋에 포함
+     * @param entries (그룹 키, 데이터) 목록
+     * @return 성공시 true (실패시 어떤 항목도 저장되지 않음)
+     */
+    bool SaveMulti(std::span<const std::pair<std::string, std::string>> entries);
+
+    /**
+     * 여러 그룹에 원자적으로 저장 (페이로드를 호출자 버퍼에서 복사 없이 전달)
+     * @param entries (그룹 키, 데이터 뷰) 목록
+     * @return 성공시 true (실패시 어떤 항목도 저장되지 않음)
+     */
+    bool SaveMulti(std::span<const std::pair<std::string, std::string_view>> entries);
 
     /**
      * 기본 로드 (상태 변경 없음, 휘발성 읽기)
@@ -75,16 +115,44 @@ public:
      */
     std::vector<std::string> Load(const std::string& group_key);
 
+    /**
+     * 병렬 기본 로드 (상태 변경 없음, 휘발성 읽기)
+     * 최대 num_threads개 배치를 내부 스레드 풀에서 동시에 읽고 제한된 재정렬 버퍼를 거쳐 FIFO 순서로 조립
+     * @param group_key 그룹 키
+     * @param num_threads 읽기 스레드 수 (1 이하면 순차 읽기)
+     * @return 데이터 목록 (FIFO 순서)
+     */
+    std::vector<std::string> Load(const std::string& group_key, size_t num_threads);
+
     /**
      * 배치 단위 로드 (트랜잭션 기반, 상태 변경 포함)
      * 한번 Load된 배치는 재Load 불가 (PENDING → LOADED)
      * 배치 ACK 처리를 위한 옵션 기능
+     * 체크섬이 맞지 않는 배치는 Loaded로 바꾸지 않음 (앞서 읽은 배치가 있으면 그 배치들만 반환, 없으면 CorruptedBatchException)
      * @param group_key 그룹 키
      * @param batch_size 배치 크기
      * @return 배치 로드 결과 목록
      */
     std::vector<BatchLoadResult> LoadBatch(const std::string& group_key, size_t batch_size);
 
+    /**
+     * 다음 배치 하나를 소비자 소유 아레나로 로드 (트랜잭션 기반, 상태 변경 포함)
+     * 아레나는 해제하지 않고 Reset 후 재사용하므로 같은 result로 반복 호출하면 할당이 거의 발생하지 않음
+     * @param group_key 그룹 키
+     * @param result 로드 결과 (이전 내용은 덮어씀, data의 뷰는 다음 호출 전까지 유효)
+     * @return 배치를 로드했으면 true (Load 가능한 배치가 없으면 false)
+     */
+    bool LoadBatch(const std::string& group_key, ArenaBatchLoadResult& result);
+
+    /**
+     * 스트리밍 소비자 생성 (테일링 커서 기반 연속 읽기)
+     * 현재 세션의 데이터를 처음부터 따라가며, 세션이 재초기화되면 새로 생성해야 함
+     * 소비자는 이 저장소의 Shutdown 전에 해제해야 함
+     * @param group_key 그룹 키
+     * @return 소비자 (세션이 없으면 nullptr)
+     */
+    std::unique_ptr<StreamConsumer> CreateConsumer(const std::string& group_key);
+
     /**
      * 배치 ACK 및 삭제
      * @param group_key 그룹 키
@@ -93,6 +161,17 @@ public:
      */
     bool AcknowledgeBatch(const std::string& group_key, const std::string& batch_id);
 
+    /**
+     * 누적 ACK (시퀀스 sequence_id 이하 전체)
+     * 그룹의 ACK 워터마크를 영속적으로 올리고, 완전히 포함된 배치의 데이터/메타데이터는 범위 삭제,
+     * 걸쳐 있는 배치는 워터마크 이하 데이터만 범위 삭제 후 시작 시퀀스를 조정 (배치 수와 무관하게 한 번의 커밋)
+     * 완전히 포함되어 삭제된 배치는 이후 AcknowledgeBatch 대상이 아님
+     * @param group_key 그룹 키
+     * @param sequence_id ACK할 마지막 시퀀스 (현재 워터마크 이하면 아무것도 하지 않음)
+     * @return 성공시 true (아직 저장되지 않은 시퀀스를 지정하거나 그룹을 가져오는 중이면 false)
+     */
+    bool AcknowledgeUpTo(const std::string& group_key, int64_t sequence_id);
+
     /**
      * 부분 처리된 배치의 Resave
      * @param group_key 그룹 키
@@ -102,7 +181,102 @@ public:
      */
     bool ResaveBatch(const std::string& group_key,
                     const std::string& batch_id,
-                    const std::vector<std::string>& remaining_data);
+                    std::span<const std::string> remaining_data);
+
+    /**
+     * 부분 처리된 배치의 Resave (남은 데이터를 호출자 버퍼에서 복사 없이 전달)
+     * @param group_key 그룹 키
+     * @param batch_id 원본 배치 ID
+     * @param remaining_data 남은 데이터 뷰 목록
+     * @return 성공시 true
+     */
+    bool ResaveBatch(const std::string& group_key,
+                    const std::string& batch_id,
+                    std::span<const std::string_view> remaining_data);
+
+    /**
+     * 등록된 그룹 목록 조회 (영속 그룹 레지스트리를 접두사 스캔)
+     * @return 그룹 키 목록 (사전순)
+     */
+    std::vector<std::string> ListGroups();
+
+    /**
+     * 그룹 삭제
+     * 그룹의 데이터, 배치 메타데이터, 세션 상태를 단일 범위 삭제로 제거
+     * (데이터 양과 무관하게 상수 시간, 중복 제거 활성 시에는 참조 해제를 위해 데이터 값을 순회)
+     * @param group_key 그룹 키
+     * @return 성공시 true (등록되지 않은 그룹이거나 그룹을 가져오는 중이면 false)
+     */
+    bool DropGroup(const std::string& group_key);
+
+    /**
+     * 유휴 그룹 축출
+     * idle_ms 이상 사용되지 않은 그룹의 세션/시퀀스/현재 배치를 저장소에 기록하고
+     * 메모리 상태를 제거 (다음 사용 시 저장된 상태에서 복원되며 세션과 시퀀스는 그대로 이어짐)
+     * 그룹 10000개 단위로 나누어 커밋하며 청크 사이에는 잠금을 풀어 다른 작업이 대기하지 않도록 함
+     * StorageOptions::idle_group_timeout_ms가 설정되면 백그라운드에서 주기적으로 수행됨
+     * @param idle_ms 유휴 시간 (밀리초, 0이면 모든 그룹 축출)
+     * @return 축출된 그룹 개수
+     */
+    size_t EvictIdleGroups(int64_t idle_ms);
+
+    /**
+     * 메모리에 상태가 있는 그룹 개수 (축출된 그룹 제외)
+     * @return 그룹 개수
+     */
+    size_t GetResidentGroupCount();
+
+    /**
+     * ACK된 큐 헤드 범위 컴팩션 (삭제 마커 제거, 완료될 때까지 블록)
+     * head_compaction_threshold 도달 시 백그라운드에서 자동으로 수행되는 작업을 즉시 실행
+     * @param group_key 그룹 키
+     * @return 성공시 true (현재 세션에서 ACK된 배치가 없으면 false)
+     */
+    bool CompactAckedHead(const std::string& group_key);
+
+    /**
+     * 오래된 PENDING 배치를 콜드 티어로 이동 (StorageOptions::cold_tier_path 필요)
+     * cold_tier_min_age_ms보다 오래되고 닫힌(더 이상 Save가 추가되지 않는) 배치의 데이터를
+     * 압축된 불변 세그먼트 파일 하나(인덱스 블록 포함 SST)로 옮기고 주 저장소에서는 범위 삭제
+     * 이동된 배치는 Load/LoadBatch에서 투명하게 세그먼트에서 읽히며, 세그먼트의 모든 배치가 ACK되면 파일 삭제
+     * @param group_key 그룹 키
+     * @return 이동된 배치 개수
+     */
+    size_t SpillColdBatches(const std::string& group_key);
+
+    /**
+     * 그룹 스냅샷을 리플레이 세그먼트로 저장 (반복 리플레이/포렌식 분석용)
+     * 현재 세션의 모든 배치(PENDING/LOADED, 콜드 티어 포함)를 키 순서대로 기록하며 배치 상태는 바꾸지 않음
+     * 결과 파일은 OpenReplaySegment로 열어 라이브 그룹과 같은 커서 인터페이스로 순회
+     * 기록하는 동안 저장소 잠금을 유지하므로 다른 작업은 스냅샷이 끝날 때까지 대기
+     * @param group_key 그룹 키
+     * @param path 출력 파일 경로
+     * @return 성공시 true (세션이 없거나 기록할 데이터가 없거나 손상된 배치가 있으면 false)
+     */
+    bool SnapshotGroup(const std::string& group_key, const std::string& path);
+
+    /**
+     * 그룹 내보내기 (정렬된 외부 SST 파일 작성)
+     * 현재 세션의 배치 메타데이터와 데이터를 스냅샷 기준으로 기록하며, 중복 제거 참조는 실제 페이로드로 변환
+     * 콜드 티어로 이동된 배치는 세그먼트에서 읽어 주 저장소 배치와 같은 형식으로 기록
+     * 내보내는 동안 그룹 잠금을 잡지 않으므로 Save는 계속 처리됨
+     * @param group_key 그룹 키
+     * @param path 출력 파일 경로
+     * @return 성공시 true (세션이 없거나 내보낼 데이터가 없거나 세그먼트를 읽을 수 없으면 false)
+     */
+    bool ExportGroup(const std::string& group_key, const std::string& path);
+
+    /**
+     * 그룹 가져오기 (ExportGroup 파일을 이 저장소의 세션/시퀀스로 재작성 후 파일 단위 수집)
+     * 배치는 새 배치 ID와 현재 시퀀스 이후의 새 범위를 받으며 모두 PENDING 상태로 추가됨
+     * 레코드별 동기 쓰기 없이 순차 재작성 1회 + IngestExternalFile로 처리
+     * 가져오는 동안 대상 그룹의 AcknowledgeUpTo/DropGroup은 거부되며,
+     * 수집 직전 세션이 바뀌었으면(TerminateSession 등) 수집하지 않고 실패
+     * @param path ExportGroup으로 만든 파일 경로
+     * @param group_key 대상 그룹 키 (빈 문자열이면 원본 그룹 키 사용)
+     * @return 성공시 true
+     */
+    bool ImportGroup(const std::string& path, const std::string& group_key = "");
 
     /**
      * 현재 세션 ID 반환
@@ -111,6 +285,41 @@ public:
      */
     std::string GetSessionId(const std::string& group_key);
 
+    /**
+     * 저장소 통계 반환 (쓰기 증폭, 파일 크기 등)
+     * @return 통계
+     */
+    StorageStats GetStorageStats();
+
+    /**
+     * 메모리 테이블을 디스크로 플러시
+     * @return 성공시 true
+     */
+    bool Flush();
+
+    /**
+     * 온라인 체크포인트 생성 (SST 하드 링크 + WAL 복사, Save 중단 없음)
+     * 생성된 디렉토리는 GroupStorage 경로로 그대로 열 수 있음
+     * @param checkpoint_dir 체크포인트 디렉토리 (같은 파일시스템 권장, 존재하지 않아야 함)
+     * @return 성공시 true
+     */
+    bool CreateCheckpoint(const std::string& checkpoint_dir);
+
+    /**
+     * 온라인 증분 백업 생성 (이전 백업과 공유하는 SST는 복사하지 않음, Save 중단 없음)
+     * 복원은 RestoreLatestBackup, 목록/정리는 ListBackups/PurgeOldBackups 사용
+     * @param backup_dir 백업 디렉토리
+     * @param info 출력 생성된 백업 정보 (nullptr 허용)
+     * @return 성공시 true
+     */
+    bool CreateBackup(const std::string& backup_dir, BackupInfo* info = nullptr);
+
+    /**
+     * 페이로드 중복 제거 통계 반환
+     * @return 통계 (중복 제거 비활성 시 모두 0)
+     */
+    DedupStats GetDedupStats() const;
+
     /**
      * 배치 크기 설정
      * @param batch_size 배치 크기
@@ -127,22 +336,144 @@ public:
 
 private:
     std::string db_path_;
+    StorageOptions options_;
     std::unique_ptr<IStorage> storage_;
     std::unique_ptr<SessionManager> session_manager_;
     std::unique_ptr<BatchManager> batch_manager_;
+    std::unique_ptr<DedupManager> dedup_manager_;
     
     std::mutex mutex_;
     std::unordered_map<std::string, int64_t> group_sequence_counters_;
     std::unordered_map<std::string, std::string> group_sessions_;
     std::unordered_map<std::string, std::string> group_current_batch_ids_;
+    std::unordered_map<std::string, int64_t> producer_high_water_marks_;
+    std::unordered_map<std::string, size_t> importing_groups_;  // ImportGroup 진행 중인 그룹별 횟수
+    std::unordered_map<std::string, int64_t> group_last_access_ms_;  // 유휴 축출 판단용 (steady clock)
+    bool has_evicted_groups_ = false;  // 저장소에 축출 상태 기록이 있을 수 있음 (false면 복원 조회 생략)
     size_t default_batch_size_;
 
+    // 그룹별 ACK 삭제량 추적 (헤드 컴팩션 트리거)
+    struct HeadCompactionState {
+        uint64_t deleted_keys = 0;
+        std::string session_id;
+        std::string last_acked_batch_id;  // ACK된 배치 중 가장 큰 ID (ULID, 생성 순서)
+    };
+    std::unordered_map<std::string, HeadCompactionState> head_compaction_states_;
+
+    // 백그라운드 헤드 컴팩션 (GroupStorage::mutex_ 없이 저장소만 사용)
+    std::thread compaction_thread_;
+    std::mutex compaction_mutex_;
+    std::condition_variable compaction_cv_;
+    std::deque<std::pair<std::string, std::string>> compaction_queue_;
+    bool compaction_running_ = false;
+
+    // 백그라운드 유휴 그룹 축출 (GroupStorage::mutex_를 잡고 작업 사이에만 실행)
+    std::thread idle_eviction_thread_;
+    std::condition_variable idle_eviction_cv_;
+    bool idle_eviction_running_ = false;
+
+    // 병렬 Load 읽기 스레드 풀 (요청된 최대 스레드 수까지 필요 시 증가)
+    std::vector<std::thread> load_threads_;
+    std::mutex load_mutex_;
+    std::condition_variable load_cv_;
+    std::deque<std::function<void()>> load_tasks_;
+    bool load_running_ = false;
+
+    /**
+     * 잠금 밖에서 저장소를 사용하는 작업 구간 (컴팩션, 내보내기/가져오기, 콜드 티어 이동, 체크포인트/백업)
+     * 구간이 남아 있으면 Shutdown은 저장소를 닫기 전에 대기
+     */
+    class StorageUse {
+    public:
+        StorageUse() = default;
+        ~StorageUse();
+        StorageUse(const StorageUse&) = delete;
+        StorageUse& operator=(const StorageUse&) = delete;
+
+        /**
+         * 구간 시작 (mutex_를 잡은 상태에서 호출)
+         * @param owner 저장소
+         * @return 시작했으면 true (종료 중이거나 저장소가 없으면 false)
+         */
+        bool BeginLocked(GroupStorage* owner);
+
+    private:
+        GroupStorage* owner_ = nullptr;
+    };
+    size_t storage_users_ = 0;       // 진행 중인 StorageUse 구간 수
+    bool shutting_down_ = false;     // Shutdown 시작 후 새 구간 거부
+    std::condition_variable storage_users_cv_;
+
+    // 메모리에 캐시할 최대 프로듀서 high-water mark 개수
+    static constexpr size_t kMaxCachedProducers = 65536;
+
+    // 유휴 그룹 축출 시 커밋 한 번에 기록할 최대 그룹 수
+    static constexpr size_t kIdleEvictionChunk = 10000;
+
     int64_t GetNextSequenceId(const std::string& group_key);
+    bool InitializeSessionLocked(const std::string& group_key);
+    std::string AllocateDataKey(const std::string& group_key,
+                                const std::string& session_id,
+                                std::vector<std::string>* created_batch_keys = nullptr);
+    void DiscardBatchKeys(const std::vector<std::string>& batch_keys);
+    template <typename Entry>
+    bool SaveMultiEntries(std::span<const Entry> entries);
+    bool PutPayload(const std::string& data_key, std::string_view data);
+    void PutPayloadToBatch(const std::string& data_key, std::string_view data);
+    std::string MakeRawStoredValue(std::string_view data, bool escape) const;
+    void ReleaseGroupReferences(const std::string& group_prefix,
+                                const std::vector<std::pair<std::string, std::string>>& ranges);
+    std::string MakeProducerKey(const std::string& group_key, const std::string& producer_id);
+    int64_t GetProducerHighWaterMark(const std::string& producer_key);
     std::string GetOrCreateSession(const std::string& group_key);
-    bool LoadBatchData(const std::string& group_key,
+    std::unordered_map<std::string, std::string>::iterator FindGroupSession(const std::string& group_key);
+    bool RestoreEvictedGroup(const std::string& group_key);
+    void DiscardEvictedGroup(const std::string& group_key);
+    size_t EvictIdleGroupsLocked(std::unique_lock<std::mutex>& lock, int64_t idle_ms);
+    void StopIdleEvictionThread();
+    void IdleEvictionWorker();
+    bool RegisterGroup(const std::string& group_key);
+    void ForgetGroup(const std::string& group_key);
+    void RecordAcknowledgedKeys(const std::string& group_key,
+                                const std::string& session_id,
+                                const std::string& batch_id,
+                                size_t deleted_keys);
+    std::vector<std::pair<std::string, std::string>> MakeHeadCompactionRanges(
+        const std::string& group_key, const HeadCompactionState& state);
+    void ScheduleCompaction(std::vector<std::pair<std::string, std::string>> ranges);
+    void StopCompactionThread();
+    void CompactionWorker();
+    bool LoadBatchData(ICursor& cursor,
+                      const std::string& group_key,
                       const std::string& session_id,
                       const std::string& batch_id,
                       BatchLoadResult& result);
+    std::unique_ptr<ICursor> NewDataCursor(const std::string& group_key,
+                                           const std::string& session_id,
+                                           bool tailing);
+    void ReadBatchesParallel(const std::string& group_key,
+                             const std::string& session_id,
+                             const std::vector<std::pair<int64_t, BatchMetadata>>& batches,
+                             size_t num_threads,
+                             std::vector<std::string>& data);
+    void RunLoadTask(std::function<void()> task, size_t num_threads);
+    void StopLoadThreads();
+    void LoadWorker();
+    size_t ReadBatchPayloads(ICursor& cursor,
+                             const std::string& group_key,
+                             const std::string& session_id,
+                             const BatchMetadata& metadata,
+                             std::vector<std::string>& data);
+    size_t ForEachBatchRecord(ICursor& cursor,
+                              const std::string& group_key,
+                              const std::string& session_id,
+                              const BatchMetadata& metadata,
+                              const std::function<bool(std::string_view, std::string&)>& visit,
+                              std::vector<uint32_t>* deferred_checksums = nullptr);
+    bool ResolveStoredValue(std::string& value, bool checksums);
+    std::string MakeSegmentPath(const std::string& segment);
+    std::string MakeSegmentRefKey(const std::string& group_key, const std::string& segment);
+    void ReleaseSegment(const std::string& group_key, const std::string& segment);
 };
 
 } // namespace durastash
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace durastash {
+
+/**
+ * 비암호화 고속 해시 유틸리티
+ * 
+ * XXH64 알고리즘 구현 (xxHash 레퍼런스와 동일한 출력)
+ * 콘텐츠 주소 기반 중복 제거 등 빠른 식별자 생성에 사용
+ */
+class Hash {
+public:
+    static constexpr size_t HEX64_LENGTH = 16;
+
+    /**
+     * XXH64 해시 계산
+     * @param data 데이터 포인터
+     * @param length 데이터 길이
+     * @param seed 시드 값
+     * @return 64비트 해시
+     */
+    static uint64_t XXH64(const void* data, size_t length, uint64_t seed = 0);
+
+    /**
+     * XXH64 해시 계산
+     * @param data 데이터
+     * @param seed 시드 값
+     * @return 64비트 해시
+     */
+    static uint64_t XXH64(std::string_view data, uint64_t seed = 0) {
+        return XXH64(data.data(), data.size(), seed);
+    }
+
+    /**
+     * 64비트 값을 고정 길이 16진수 문자열로 변환
+     * @param value 변환할 값
+     * @return 16자 소문자 16진수 문자열
+     */
+    static std::string ToHex(uint64_t value);
+};
+
+} // namespace durastash
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace durastash {
+
+/**
+ * 데이터 키 시퀀스 포맷 유틸리티
+ *
+ * 데이터 키 끝의 시퀀스 ID는 사전순과 숫자순이 일치하도록 0으로 채운 20자리 십진수로 기록됨
+ * (group:session:<batch_id>:<seq 20자리>). 스트림/로캘 없이 두 자리 테이블로 고정 폭을 바로 쓰고,
+ * 파싱은 8자리씩 SWAR로 검증/변환
+ */
+class KeyFormat {
+public:
+    static constexpr size_t SEQUENCE_DIGITS = 20;
+
+    /**
+     * 시퀀스 ID를 0으로 채운 20자리 십진수로 기록 (분기 없는 고정 횟수 연산)
+     * @param out 출력 버퍼 (SEQUENCE_DIGITS 바이트 이상)
+     * @param sequence_id 시퀀스 ID (0 이상)
+     */
+    static void FormatSequence(char* out, int64_t sequence_id);
+
+    /**
+     * 키 끝에 20자리 시퀀스 추가
+     * @param key 키 버퍼
+     * @param sequence_id 시퀀스 ID (0 이상)
+     */
+    static void AppendSequence(std::string& key, int64_t sequence_id) {
+        size_t offset = key.size();
+        key.resize(offset + SEQUENCE_DIGITS);
+        FormatSequence(key.data() + offset, sequence_id);
+    }
+
+    /**
+     * 20자리 십진수 시퀀스 파싱
+     * @param digits 정확히 SEQUENCE_DIGITS 길이의 숫자열
+     * @param sequence_id 출력 시퀀스 ID
+     * @return 성공시 true (길이가 다르거나 숫자가 아니거나 int64 범위를 넘으면 false)
+     */
+    static bool ParseSequence(std::string_view digits, int64_t& sequence_id);
+
+    /**
+     * 데이터 키 끝의 시퀀스 ID 파싱
+     * @param key 데이터 키
+     * @param sequence_id 출력 시퀀스 ID
+     * @return 성공시 true
+     */
+    static bool ParseKeySequence(std::string_view key, int64_t& sequence_id) {
+        return key.size() >= SEQUENCE_DIGITS &&
+               ParseSequence(key.substr(key.size() - SEQUENCE_DIGITS), sequence_id);
+    }
+};
+
+} // namespace durastash
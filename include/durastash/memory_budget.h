@@ -0,0 +1,72 @@
+#pragma once
+
+#include <memory>
+#include <cstddef>
+
+namespace rocksdb {
+class Cache;
+class WriteBufferManager;
+}
+
+namespace durastash {
+
+/**
+ * 프로세스 전역 메모리 예산
+ * 여러 저장소 인스턴스가 하나의 블록 캐시와 WriteBufferManager를 공유하여
+ * 메모리 테이블 + 블록 캐시 + 인덱스/필터 블록의 총 사용량을 상한 이내로 제한
+ * (메모리 테이블 사용량은 블록 캐시에 더미 항목으로 청구됨)
+ *
+ * StorageOptions::memory_budget에 같은 인스턴스를 전달하여 공유
+ */
+class MemoryBudget {
+public:
+    /**
+     * 메모리 예산 생성
+     * @param capacity 전체 메모리 상한 (바이트)
+     * @param write_buffer_ratio 상한 중 메모리 테이블에 허용할 비율 (0.0 ~ 1.0)
+     * @return 메모리 예산
+     */
+    static std::shared_ptr<MemoryBudget> Create(size_t capacity, double write_buffer_ratio = 0.5);
+
+    /**
+     * 전체 메모리 상한
+     */
+    size_t GetCapacity() const {
+        return capacity_;
+    }
+
+    /**
+     * 메모리 테이블 상한 (초과 시 플러시, 플러시가 따라가지 못하면 쓰기 지연)
+     */
+    size_t GetWriteBufferLimit() const {
+        return write_buffer_limit_;
+    }
+
+    /**
+     * 현재 공유 캐시 사용량 (블록 + 메모리 테이블 청구분, 바이트)
+     */
+    size_t GetUsage() const;
+
+    /**
+     * 현재 전체 메모리 테이블 사용량 (바이트)
+     */
+    size_t GetWriteBufferUsage() const;
+
+    const std::shared_ptr<rocksdb::Cache>& GetBlockCache() const {
+        return block_cache_;
+    }
+
+    const std::shared_ptr<rocksdb::WriteBufferManager>& GetWriteBufferManager() const {
+        return write_buffer_manager_;
+    }
+
+private:
+    MemoryBudget(size_t capacity, size_t write_buffer_limit);
+
+    size_t capacity_;
+    size_t write_buffer_limit_;
+    std::shared_ptr<rocksdb::Cache> block_cache_;
+    std::shared_ptr<rocksdb::WriteBufferManager> write_buffer_manager_;
+};
+
+} // namespace durastash
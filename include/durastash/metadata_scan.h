@@ -0,0 +1,66 @@
+#pragma once
+
+#include "durastash/types.h"
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace durastash {
+
+/**
+ * 배치 메타데이터 JSON 원시 바이트 스캔 유틸리티
+ *
+ * 저장된 메타데이터는 jsonable이 공백 없이 기록한 평탄한 객체이므로 DOM을 만들지 않고
+ * "필드":값 패턴을 바이트 검색(SSE2/AVX2, 아니면 스칼라)으로 찾아 필요한 필드만 읽음.
+ * 형식이 예상과 다르면(공백, 이스케이프, 누락 필드 등) false를 반환하며, 호출자는 fromJson으로 전체 파싱
+ */
+class MetadataScan {
+public:
+    /**
+     * 부분 문자열 검색 (첫/마지막 바이트 후보를 벡터 비교로 걸러낸 뒤 확인)
+     * @param haystack 검색 대상
+     * @param needle 찾을 문자열
+     * @param from 검색 시작 위치
+     * @return 찾은 위치 (없으면 std::string_view::npos)
+     */
+    static size_t Find(std::string_view haystack, std::string_view needle, size_t from = 0);
+
+    /**
+     * 스칼라 부분 문자열 검색 (벡터 경로 검증/비교용)
+     */
+    static size_t FindPortable(std::string_view haystack, std::string_view needle, size_t from = 0);
+
+    /**
+     * 사용 중인 벡터 명령 집합 이름
+     * @return "avx2", "sse2" 또는 "scalar"
+     */
+    static const char* VectorIsa();
+
+    /**
+     * status 필드 조회
+     * @param json 메타데이터 JSON
+     * @param status 출력 상태
+     * @return 찾으면 true (필드가 없거나 알 수 없는 값이면 false)
+     */
+    static bool ProbeStatus(std::string_view json, BatchStatus& status);
+
+    /**
+     * 정수 필드 조회
+     * @param json 메타데이터 JSON
+     * @param field 필드 이름 (예: "sequence_start")
+     * @param value 출력 값
+     * @return 찾으면 true (필드가 없거나 정수가 아니면 false)
+     */
+    static bool ProbeInt64(std::string_view json, std::string_view field, int64_t& value);
+
+    /**
+     * 메타데이터 전체를 원시 바이트에서 디코딩 (BatchMetadata::loadFromJson과 같은 결과)
+     * @param json 메타데이터 JSON
+     * @param metadata 출력 메타데이터
+     * @return 성공시 true (형식이 다르면 false, metadata는 일부만 갱신될 수 있음)
+     */
+    static bool Decode(std::string_view json, BatchMetadata& metadata);
+};
+
+} // namespace durastash
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace durastash {
+
+class MemoryBudget;
+
+/**
+ * 압축 방식
+ * RocksDB 빌드에 해당 압축 라이브러리가 포함되어 있어야 함 (NONE 제외)
+ */
+enum class Compression {
+    NONE,
+    SNAPPY,
+    LZ4,
+    ZSTD
+};
+
+/**
+ * 컴팩션 프로파일
+ */
+enum class CompactionProfile {
+    LEVELED,    // 레벨 컴팩션 + level_compaction_dynamic_level_bytes (기본, 범용)
+    UNIVERSAL   // 유니버설 컴팩션 (append 후 헤드 삭제 큐 워크로드에서 쓰기 증폭 감소)
+};
+
+/**
+ * 저장소 옵션
+ * GroupStorage 생성 시 전달하며, 기본값은 기존 동작과 동일
+ */
+struct StorageOptions {
+    /**
+     * 콘텐츠 주소 기반 페이로드 중복 제거 최소 크기 (바이트, 0이면 비활성)
+     * 이 크기 이상의 페이로드는 콘텐츠 해시 키로 한 번만 저장되고,
+     * 데이터 키에는 해시 참조만 저장됨 (참조 카운트는 ACK 시 병합 연산자로 감소)
+     */
+    size_t dedup_min_size = 0;
+
+    /**
+     * 레코드별 CRC32C 체크섬 (Save 시 기록, Load/LoadBatch/스트리밍 소비 시 검증)
+     * 새로 생성되는 배치에만 적용되며 배치 메타데이터에 표시되므로 기존 배치와 섞여도 됨
+     * 불일치 시 CorruptedBatchException 발생
+     */
+    bool enable_checksums = false;
+
+    /**
+     * 메모리 테이블 크기 (바이트)
+     */
+    size_t write_buffer_size = 64 * 1024 * 1024;
+
+    /**
+     * 공유 메모리 예산 (nullptr이면 인스턴스별 기본 블록 캐시/메모리 테이블 사용)
+     * 같은 예산을 공유하는 모든 저장소의 메모리 테이블과 블록 캐시 합계가 예산 이내로 제한됨
+     */
+    std::shared_ptr<MemoryBudget> memory_budget;
+
+    /**
+     * RocksDB 통계 수집 (쓰기 증폭 등 GetStorageStats의 누적 I/O 항목에 필요)
+     */
+    bool enable_statistics = false;
+
+    /**
+     * 컴팩션 프로파일
+     */
+    CompactionProfile compaction_profile = CompactionProfile::LEVELED;
+
+    /**
+     * 헤드 컴팩션 임계값 (그룹별 ACK로 삭제된 키 수, 0이면 비활성)
+     * 도달하면 ACK된 헤드 범위에 대해 백그라운드에서 CompactRange를 실행하여
+     * 로드 시 삭제 마커를 건너뛰는 비용이 누적되지 않도록 함 (ACK가 많은 워크로드에서 예: 100000)
+     */
+    uint64_t head_compaction_threshold = 0;
+
+    /**
+     * CompactOnDeletionCollector 슬라이딩 윈도우 크기 (엔트리 수, 0이면 비활성)
+     * SST 파일 내 연속한 윈도우에 삭제 마커가 trigger 이상 있으면 컴팩션 대상으로 표시 (예: 128 * 1024)
+     */
+    size_t deletion_compaction_window = 0;
+
+    /**
+     * CompactOnDeletionCollector 윈도우 내 삭제 마커 개수 임계값
+     */
+    size_t deletion_compaction_trigger = 16 * 1024;
+
+    /**
+     * CompactOnDeletionCollector 파일 전체 삭제 마커 비율 임계값 (0이면 비율 조건 미사용)
+     */
+    double deletion_compaction_ratio = 0.0;
+
+    /**
+     * 최대 동시 오픈 SST 파일 수 (-1이면 DB 오픈 시 모든 파일을 미리 열어 둠)
+     * SST 파일이 많은 저장소에서는 제한하면 오픈 시 파일 footer 읽기를 필요 시점으로 미룸
+     */
+    int max_open_files = -1;
+
+    /**
+     * DB 오픈 시 SST 파일별 통계 갱신 생략 (오픈 시간 단축)
+     */
+    bool skip_stats_update_on_db_open = false;
+
+    /**
+     * DB 오픈 시 SST 파일 크기 검증 생략 (오픈 시간 단축)
+     */
+    bool skip_checking_sst_file_sizes_on_db_open = false;
+
+    /**
+     * DB 오픈 시 SST 파일을 병렬로 여는 스레드 수 (max_open_files가 -1일 때 적용)
+     */
+    int max_file_opening_threads = 16;
+
+    /**
+     * 지연 복구: Initialize는 DB 오픈 직후 반환하고 부가 상태는 백그라운드에서 복구
+     * (그룹 레지스트리는 필요할 때 저장소에서 직접 조회하므로 현재는 복구할 상태가 없음)
+     */
+    bool lazy_recovery = false;
+
+    /**
+     * 백그라운드 I/O(플러시/컴팩션) 속도 상한 (바이트/초, 0이면 비활성)
+     * 자동 튜닝 모드에서는 이 값을 상한으로 실제 속도를 수요에 맞게 조절
+     * 포그라운드 쓰기(WAL)는 제한하지 않으며, 플러시는 컴팩션보다 높은 우선순위로 처리됨
+     */
+    int64_t rate_limit_bytes_per_sec = 0;
+
+    /**
+     * 속도 제한 자동 튜닝 (백그라운드 I/O 수요가 적으면 제한을 낮추고 많으면 상한까지 높임)
+     */
+    bool rate_limiter_auto_tuned = true;
+
+    /**
+     * 컴팩션 읽기도 속도 제한에 포함 (포그라운드 읽기는 최우선 순위로 청구)
+     */
+    bool rate_limit_reads = false;
+
+    /**
+     * 범위 읽기(Load/LoadBatch/Scan) 반복자 readahead 크기 (바이트, 0이면 RocksDB 자동 readahead)
+     * 디스크에서 콜드 배치를 읽을 때 블록 단위 동기 읽기 횟수를 줄임
+     */
+    size_t readahead_size = 0;
+
+    /**
+     * 순차 읽기 패턴에 따라 readahead 크기를 자동으로 늘림
+     */
+    bool adaptive_readahead = false;
+
+    /**
+     * 범위 읽기 시 비동기 I/O로 다음 블록을 미리 읽음
+     * (RocksDB가 liburing과 함께 빌드된 경우 io_uring 사용, 아니면 동기 읽기로 동작)
+     */
+    bool async_io = false;
+
+    /**
+     * Load 기본 병렬 읽기 스레드 수 (1이면 호출 스레드에서 순차 읽기)
+     * 2 이상이면 내부 스레드 풀에서 배치를 동시에 읽고, 스레드 수의 2배 배치 크기의 재정렬 버퍼로 FIFO 순서 복원
+     */
+    size_t load_threads = 1;
+
+    /**
+     * BlobDB: 큰 값을 LSM 밖의 blob 파일로 분리 저장
+     * 컴팩션 시 큰 페이로드를 레벨마다 다시 쓰지 않아 쓰기 증폭 감소
+     */
+    bool enable_blob_files = false;
+
+    /**
+     * blob 파일로 분리할 최소 값 크기 (바이트)
+     * 배치 메타데이터/세션 상태 등 작은 값은 LSM에 남도록 페이로드 크기 기준으로 설정
+     */
+    uint64_t min_blob_size = 4096;
+
+    /**
+     * blob 파일 최대 크기 (바이트)
+     */
+    uint64_t blob_file_size = 256 * 1024 * 1024;
+
+    /**
+     * blob 파일 압축 방식
+     */
+    Compression blob_compression = Compression::NONE;
+
+    /**
+     * blob 가비지 컬렉션 (ACK로 삭제된 페이로드가 차지하는 blob 파일 회수)
+     */
+    bool enable_blob_garbage_collection = true;
+
+    /**
+     * 가비지 컬렉션 대상 blob 파일 비율 (가장 오래된 파일부터, 0.0 ~ 1.0)
+     */
+    double blob_garbage_collection_age_cutoff = 0.25;
+
+    /**
+     * 유휴 그룹 축출 시간 (밀리초, 0이면 자동 축출 비활성)
+     * 이 시간 동안 사용되지 않은 그룹의 메모리 상태(세션/시퀀스/현재 배치)를 저장소에 기록하고 메모리에서 제거
+     * 다음 사용 시 저장된 상태에서 복원되며, 검사는 백그라운드에서 축출 시간의 절반 주기로 수행됨
+     */
+    int64_t idle_group_timeout_ms = 0;
+
+    /**
+     * 콜드 티어 세그먼트 디렉토리 (비어 있으면 비활성)
+     * GroupStorage::SpillColdBatches가 오래된 PENDING 배치를 이 디렉토리의 불변 세그먼트 파일로 옮김
+     * 주 저장소보다 느린 별도 디스크를 지정할 수 있음
+     */
+    std::string cold_tier_path;
+
+    /**
+     * 콜드 티어로 옮길 배치의 최소 경과 시간 (밀리초, 배치 생성 시각 기준)
+     */
+    int64_t cold_tier_min_age_ms = 24 * 60 * 60 * 1000;
+
+    /**
+     * 세그먼트 파일 압축 방식 (RocksDB 빌드에 포함된 압축 라이브러리만 지정 가능)
+     */
+    Compression cold_tier_compression = Compression::NONE;
+};
+
+} // namespace durastash
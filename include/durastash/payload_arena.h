@@ -0,0 +1,120 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+
+namespace durastash {
+
+/**
+ * 재사용 페이로드 아레나
+ *
+ * 페이로드를 하나의 연속 버퍼에 이어 붙이고 경계 오프셋만 따로 보관.
+ * Reset은 용량을 유지하므로 같은 아레나로 배치를 반복 로드하면 할당이 거의 발생하지 않음.
+ * 반환되는 string_view는 다음 Append/Reset 전까지만 유효
+ */
+class PayloadArena {
+public:
+    /**
+     * 페이로드 순회 반복자 (string_view 반환)
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        const_iterator() = default;
+        const_iterator(const PayloadArena* arena, size_t index) : arena_(arena), index_(index) {}
+
+        std::string_view operator*() const { return (*arena_)[index_]; }
+        std::string_view operator[](difference_type n) const { return (*arena_)[index_ + n]; }
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator copy = *this; ++index_; return copy; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { const_iterator copy = *this; --index_; return copy; }
+        const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(arena_, index_ + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(arena_, index_ - n); }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+        bool operator<(const const_iterator& other) const { return index_ < other.index_; }
+
+    private:
+        const PayloadArena* arena_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    PayloadArena() : offsets_(1, 0) {}
+
+    /**
+     * 모든 페이로드 제거 (버퍼 용량은 유지)
+     */
+    void Reset() {
+        buffer_.clear();
+        offsets_.resize(1);
+    }
+
+    /**
+     * 페이로드 추가 (버퍼 끝에 복사)
+     * @param payload 페이로드
+     */
+    void Append(std::string_view payload) {
+        buffer_.append(payload.data(), payload.size());
+        offsets_.push_back(buffer_.size());
+    }
+
+    /**
+     * 예상 크기만큼 미리 확보
+     * @param count 페이로드 수
+     * @param bytes 전체 바이트 수
+     */
+    void Reserve(size_t count, size_t bytes) {
+        offsets_.reserve(count + 1);
+        buffer_.reserve(bytes);
+    }
+
+    std::string_view operator[](size_t index) const {
+        return std::string_view(buffer_.data() + offsets_[index], offsets_[index + 1] - offsets_[index]);
+    }
+
+    size_t size() const { return offsets_.size() - 1; }
+    bool empty() const { return offsets_.size() == 1; }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    /**
+     * 저장된 페이로드 전체 바이트 수
+     */
+    size_t Bytes() const { return buffer_.size(); }
+
+    /**
+     * 할당된 버퍼 용량 (바이트)
+     */
+    size_t Capacity() const { return buffer_.capacity(); }
+
+private:
+    std::string buffer_;           // 페이로드 연속 버퍼
+    std::vector<size_t> offsets_;  // 페이로드 경계 (offsets_[i] ~ offsets_[i + 1])
+};
+
+/**
+ * 아레나 기반 배치 로드 결과 (소비자별로 하나를 두고 배치마다 재사용)
+ */
+struct ArenaBatchLoadResult {
+    std::string batch_id;              // 배치 ID
+    PayloadArena data;                 // 데이터 목록 (string_view, 다음 로드 전까지 유효)
+    int64_t sequence_start = 0;        // 시퀀스 시작
+    int64_t sequence_end = 0;          // 시퀀스 종료
+};
+
+} // namespace durastash
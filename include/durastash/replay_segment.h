@@ -0,0 +1,76 @@
+#pragma once
+
+#include "durastash/cursor.h"
+#include "durastash/external_file.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <cstdint>
+
+namespace durastash {
+
+/**
+ * 리플레이 세그먼트 작성기
+ *
+ * 반복 리플레이용 읽기 전용 파일 형식. mmap으로 열어 복사/할당 없이 순회할 수 있도록
+ * 모든 값을 고정 위치에 두며, 다음 순서로 기록됨 (정수는 호스트 바이트 순서, 리틀 엔디언 기준)
+ *   헤더 (48바이트): magic "DSREPLAY", version, reserved, record_count, index_offset, file_size, checksum
+ *   레코드 영역: 레코드마다 키 바이트 + 값 바이트
+ *   레코드 오프셋 테이블 (8바이트 정렬): 레코드마다 {offset(8), key_size(4), value_size(4)}
+ * checksum은 레코드 순서대로 XXH64를 연쇄(이전 결과를 시드로)한 값을 시드로 오프셋 테이블을 해시한 값
+ *
+ * 키는 반드시 오름차순(바이트 비교)으로 추가해야 함 (커서 Seek는 이진 탐색)
+ */
+class ReplaySegmentWriter : public IExternalFileWriter {
+public:
+    ReplaySegmentWriter() = default;
+    ~ReplaySegmentWriter() override = default;
+
+    bool Open(const std::string& path) override;
+    bool Put(const std::string& key, const std::string& value) override;
+    bool Finish() override;
+
+    /**
+     * 키-값 추가 (직전 키보다 커야 함)
+     * @param key 키
+     * @param value 값
+     * @return 성공시 true
+     */
+    bool Put(std::string_view key, std::string_view value);
+
+    /**
+     * 지금까지 추가된 레코드 수
+     * @return 레코드 수
+     */
+    uint64_t GetRecordCount() const {
+        return index_.size();
+    }
+
+private:
+    struct IndexEntry {
+        uint64_t offset;
+        uint32_t key_size;
+        uint32_t value_size;
+    };
+
+    std::ofstream file_;
+    std::vector<IndexEntry> index_;
+    std::string last_key_;
+    std::string record_;  // 레코드 기록/해시용 재사용 버퍼
+    uint64_t offset_ = 0;
+    uint64_t checksum_ = 0;
+};
+
+/**
+ * 리플레이 세그먼트 열기 (읽기 전용 메모리 매핑)
+ * 반환된 커서의 Key/Value는 매핑된 메모리를 직접 가리키며, 순회 중 시스템 호출이나 할당이 없음
+ * 커서가 해제될 때 매핑도 해제됨
+ * @param path 세그먼트 파일 경로
+ * @param verify_checksum 열 때 전체 체크섬 검증 여부
+ * @return 커서 (형식이 잘못되었거나 체크섬이 맞지 않으면 nullptr)
+ */
+std::unique_ptr<ICursor> OpenReplaySegment(const std::string& path, bool verify_checksum = true);
+
+} // namespace durastash
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "durastash/storage.h"
+#include "durastash/options.h"
 #include <rocksdb/db.h>
 #include <rocksdb/write_batch.h>
 #include <rocksdb/options.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/rate_limiter.h>
 #include <memory>
 #include <mutex>
 
@@ -14,16 +17,19 @@ namespace durastash {
  */
 class RocksDBStorage : public IStorage {
 public:
-    RocksDBStorage();
+    explicit RocksDBStorage(const StorageOptions& options = StorageOptions());
     ~RocksDBStorage() override;
 
     // IStorage 인터페이스 구현
     bool Initialize(const std::string& db_path) override;
     void Shutdown() override;
-    bool Put(const std::string& key, const std::string& value) override;
-    bool Get(const std::string& key, std::string& value) override;
-    bool Delete(const std::string& key) override;
-    bool Exists(const std::string& key) override;
+    bool Put(std::string_view key, std::string_view value) override;
+    bool Get(std::string_view key, std::string& value) override;
+    bool Delete(std::string_view key) override;
+    bool DeleteRange(std::string_view start_key, std::string_view end_key) override;
+    bool MergeCounter(std::string_view key, int64_t delta) override;
+    bool GetCounter(std::string_view key, int64_t& value) override;
+    bool Exists(std::string_view key) override;
     size_t Scan(const std::string& start_key, 
                 const std::string& end_key,
                 std::vector<std::string>& keys,
@@ -32,20 +38,45 @@ public:
     size_t ScanPrefix(const std::string& prefix,
                       std::vector<std::string>& keys,
                       std::vector<std::string>& values) override;
+    std::unique_ptr<ICursor> NewCursor(const std::string& lower_bound,
+                                       const std::string& upper_bound,
+                                       bool tailing = false) override;
+    bool Flush() override;
+    bool CompactRange(const std::string& start_key, const std::string& end_key) override;
+    bool GetStats(StorageStats& stats) override;
+    bool CreateCheckpoint(const std::string& checkpoint_dir) override;
+    bool CreateBackup(const std::string& backup_dir, BackupInfo* info = nullptr) override;
+    std::unique_ptr<IExternalFileWriter> NewExternalFileWriter(Compression compression = Compression::NONE) override;
+    std::unique_ptr<ICursor> OpenExternalFile(const std::string& path) override;
+    bool IngestExternalFiles(const std::vector<std::string>& paths, bool move_files) override;
     bool BeginBatch() override;
-    void PutToBatch(const std::string& key, const std::string& value) override;
-    void DeleteFromBatch(const std::string& key) override;
+    void PutToBatch(std::string_view key, std::string_view value) override;
+    void DeleteFromBatch(std::string_view key) override;
+    void DeleteRangeFromBatch(std::string_view start_key, std::string_view end_key) override;
+    void MergeCounterToBatch(std::string_view key, int64_t delta) override;
     bool CommitBatch() override;
     void RollbackBatch() override;
 
+    // 백업 관리 (저장소 인스턴스 없이 사용)
+    static bool RestoreLatestBackup(const std::string& backup_dir, const std::string& db_path);
+    static std::vector<BackupInfo> ListBackups(const std::string& backup_dir);
+    static bool PurgeOldBackups(const std::string& backup_dir, uint32_t num_backups_to_keep);
+
 private:
+    StorageOptions options_;
+    std::shared_ptr<rocksdb::Statistics> statistics_;
+    std::shared_ptr<rocksdb::RateLimiter> rate_limiter_;
     std::unique_ptr<rocksdb::DB> db_;
     std::unique_ptr<rocksdb::WriteBatch> current_batch_;
     std::mutex mutex_;
     bool initialized_ = false;
 
     rocksdb::ReadOptions read_options_;
+    rocksdb::ReadOptions scan_options_;  // 범위 읽기용 (readahead/비동기 I/O 적용)
     rocksdb::WriteOptions write_options_;
+
+    void ApplyCompactionProfile(rocksdb::Options& options) const;
+    rocksdb::DB* GetDB();
 };
 
 } // namespace durastash
@@ -1,14 +1,62 @@
 #pragma once
 
+#include "durastash/cursor.h"
+#include "durastash/external_file.h"
+#include "durastash/options.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
+#include <cstdint>
 
 namespace durastash {
 
+/**
+ * 저장소 통계
+ * 누적 I/O 항목은 StorageOptions::enable_statistics가 켜져 있을 때만 수집됨
+ */
+struct StorageStats {
+    uint64_t user_bytes_written = 0;        // 사용자 쓰기 바이트 (Put/Delete/Merge/Write)
+    uint64_t flush_bytes_written = 0;       // 플러시로 기록된 SST 바이트
+    uint64_t compaction_bytes_written = 0;  // 컴팩션으로 기록된 바이트
+    uint64_t compaction_bytes_read = 0;     // 컴팩션으로 읽은 바이트
+    uint64_t blob_bytes_written = 0;        // blob 파일에 기록된 바이트 (플러시/컴팩션 바이트에 이미 포함)
+    uint64_t sst_files_size = 0;            // 현재 SST 파일 총 크기
+    uint64_t blob_files_size = 0;           // 현재 blob 파일 총 크기
+    uint64_t live_data_size = 0;            // 추정 유효 데이터 크기
+    uint64_t memtable_bytes = 0;            // 이 인스턴스의 메모리 테이블 사용량
+    uint64_t table_readers_bytes = 0;       // 이 인스턴스의 인덱스/필터 블록 메모리 (캐시 밖)
+    uint64_t block_cache_bytes = 0;         // 블록 캐시 사용량 (공유 예산이면 공유 캐시 전체)
+    int64_t rate_limit_bytes_per_sec = 0;   // 현재 백그라운드 I/O 속도 상한 (자동 튜닝 반영, 0이면 비활성)
+    int64_t rate_limited_bytes = 0;         // 속도 제한기를 통과한 누적 바이트
+
+    /**
+     * 쓰기 증폭 (플러시/컴팩션 기록 바이트 / 사용자 쓰기 바이트, WAL 제외)
+     * blob 파일 기록은 플러시/컴팩션 바이트에 포함되므로 따로 더하지 않음
+     */
+    double WriteAmplification() const {
+        if (user_bytes_written == 0) {
+            return 0.0;
+        }
+        return static_cast<double>(flush_bytes_written + compaction_bytes_written) /
+               static_cast<double>(user_bytes_written);
+    }
+};
+
+/**
+ * 백업 정보
+ */
+struct BackupInfo {
+    uint32_t backup_id = 0;     // 백업 ID (1부터 증가)
+    int64_t timestamp = 0;      // 생성 시각 (유닉스 초)
+    uint64_t size = 0;          // 백업 크기 (바이트, 이전 백업과 공유하는 파일 포함)
+    uint32_t number_files = 0;  // 백업 파일 수
+};
+
 /**
  * 저장소 인터페이스 (DIP 준수)
  * 다양한 저장소 구현체를 지원하기 위한 추상화
+ * 키/값 인자는 std::string_view로 받으므로 호출자 버퍼를 임시 문자열 없이 전달 가능 (호출 동안만 유효하면 됨)
  */
 class IStorage {
 public:
@@ -32,7 +80,7 @@ public:
      * @param value 값
      * @return 성공시 true
      */
-    virtual bool Put(const std::string& key, const std::string& value) = 0;
+    virtual bool Put(std::string_view key, std::string_view value) = 0;
 
     /**
      * 키-값 조회
@@ -40,21 +88,45 @@ public:
      * @param value 출력 값
      * @return 성공시 true
      */
-    virtual bool Get(const std::string& key, std::string& value) = 0;
+    virtual bool Get(std::string_view key, std::string& value) = 0;
 
     /**
      * 키 삭제
      * @param key 키
      * @return 성공시 true
      */
-    virtual bool Delete(const std::string& key) = 0;
+    virtual bool Delete(std::string_view key) = 0;
+
+    /**
+     * 범위 삭제 (단일 범위 톰스톤, 데이터 양과 무관하게 상수 시간)
+     * @param start_key 시작 키 (포함)
+     * @param end_key 종료 키 (미포함)
+     * @return 성공시 true
+     */
+    virtual bool DeleteRange(std::string_view start_key, std::string_view end_key) = 0;
+
+    /**
+     * 카운터 키에 증감값 병합 (읽기 없이 쓰기, 병합 연산자 기반)
+     * @param key 카운터 키
+     * @param delta 증감값
+     * @return 성공시 true
+     */
+    virtual bool MergeCounter(std::string_view key, int64_t delta) = 0;
+
+    /**
+     * 카운터 값 조회
+     * @param key 카운터 키
+     * @param value 출력 값
+     * @return 성공시 true (키가 없으면 false)
+     */
+    virtual bool GetCounter(std::string_view key, int64_t& value) = 0;
 
     /**
      * 키 존재 여부 확인
      * @param key 키
      * @return 존재시 true
      */
-    virtual bool Exists(const std::string& key) = 0;
+    virtual bool Exists(std::string_view key) = 0;
 
     /**
      * 범위 스캔
@@ -82,6 +154,78 @@ public:
                               std::vector<std::string>& keys,
                               std::vector<std::string>& values) = 0;
 
+    /**
+     * 범위 커서 생성
+     * @param lower_bound 하한 키 (포함)
+     * @param upper_bound 상한 키 (미포함)
+     * @param tailing true면 테일링 커서 (Refresh 없이 Seek만으로 새로 추가된 키가 보임,
+     *                매 조회마다 새 반복자/스냅샷을 만들지 않아 연속 스트리밍 읽기에 적합)
+     * @return 커서 (저장소가 초기화되지 않았으면 nullptr)
+     */
+    virtual std::unique_ptr<ICursor> NewCursor(const std::string& lower_bound,
+                                               const std::string& upper_bound,
+                                               bool tailing = false) = 0;
+
+    /**
+     * 메모리 테이블을 디스크로 플러시
+     * @return 성공시 true
+     */
+    virtual bool Flush() = 0;
+
+    /**
+     * 키 범위 수동 컴팩션 (삭제 마커 제거)
+     * 컴팩션이 끝날 때까지 블록되며, 다른 읽기/쓰기와 동시에 호출 가능
+     * @param start_key 시작 키 (포함)
+     * @param end_key 종료 키 (미포함)
+     * @return 성공시 true
+     */
+    virtual bool CompactRange(const std::string& start_key, const std::string& end_key) = 0;
+
+    /**
+     * 저장소 통계 조회
+     * @param stats 출력 통계
+     * @return 성공시 true
+     */
+    virtual bool GetStats(StorageStats& stats) = 0;
+
+    /**
+     * 체크포인트 생성 (같은 파일시스템이면 SST 파일을 하드 링크로 공유, 쓰기 중단 없음)
+     * 생성된 디렉토리는 그대로 저장소 경로로 열 수 있음
+     * @param checkpoint_dir 체크포인트 디렉토리 (존재하지 않아야 함)
+     * @return 성공시 true
+     */
+    virtual bool CreateCheckpoint(const std::string& checkpoint_dir) = 0;
+
+    /**
+     * 증분 백업 생성 (이전 백업에 이미 있는 SST 파일은 다시 복사하지 않음, 쓰기 중단 없음)
+     * @param backup_dir 백업 디렉토리 (여러 백업이 누적됨)
+     * @param info 출력 생성된 백업 정보 (nullptr 허용)
+     * @return 성공시 true
+     */
+    virtual bool CreateBackup(const std::string& backup_dir, BackupInfo* info = nullptr) = 0;
+
+    /**
+     * 외부 정렬 파일 작성기 생성 (IngestExternalFiles로 수집 가능한 형식)
+     * @param compression 블록 압축 방식
+     * @return 작성기
+     */
+    virtual std::unique_ptr<IExternalFileWriter> NewExternalFileWriter(Compression compression = Compression::NONE) = 0;
+
+    /**
+     * 외부 정렬 파일을 커서로 열기 (저장소에 수집하지 않고 읽기)
+     * @param path 파일 경로
+     * @return 커서 (열기 실패시 nullptr)
+     */
+    virtual std::unique_ptr<ICursor> OpenExternalFile(const std::string& path) = 0;
+
+    /**
+     * 외부 정렬 파일 수집 (레코드별 쓰기 없이 파일 단위로 LSM에 추가)
+     * @param paths 파일 경로 목록
+     * @param move_files true면 복사 대신 이동 (같은 파일시스템에서 하드 링크)
+     * @return 성공시 true
+     */
+    virtual bool IngestExternalFiles(const std::vector<std::string>& paths, bool move_files) = 0;
+
     /**
      * 배치 쓰기 시작
      * @return 성공시 true
@@ -93,13 +237,27 @@ public:
      * @param key 키
      * @param value 값
      */
-    virtual void PutToBatch(const std::string& key, const std::string& value) = 0;
+    virtual void PutToBatch(std::string_view key, std::string_view value) = 0;
 
     /**
      * 배치에서 키 삭제 추가
      * @param key 키
      */
-    virtual void DeleteFromBatch(const std::string& key) = 0;
+    virtual void DeleteFromBatch(std::string_view key) = 0;
+
+    /**
+     * 배치에 범위 삭제 추가
+     * @param start_key 시작 키 (포함)
+     * @param end_key 종료 키 (미포함)
+     */
+    virtual void DeleteRangeFromBatch(std::string_view start_key, std::string_view end_key) = 0;
+
+    /**
+     * 배치에 카운터 증감값 병합 추가
+     * @param key 카운터 키
+     * @param delta 증감값
+     */
+    virtual void MergeCounterToBatch(std::string_view key, int64_t delta) = 0;
 
     /**
      * 배치 쓰기 커밋
@@ -115,8 +273,32 @@ public:
 
 /**
  * 저장소 팩토리 함수
+ * @param options 저장소 옵션
+ */
+std::unique_ptr<IStorage> CreateStorage(const StorageOptions& options);
+
+/**
+ * 가장 최근 백업으로 저장소 복원
+ * @param backup_dir 백업 디렉토리
+ * @param db_path 복원할 저장소 경로 (열려 있지 않아야 하며, 기존 파일은 대체됨)
+ * @return 성공시 true
+ */
+bool RestoreLatestBackup(const std::string& backup_dir, const std::string& db_path);
+
+/**
+ * 백업 목록 조회
+ * @param backup_dir 백업 디렉토리
+ * @return 백업 정보 목록 (오래된 순)
+ */
+std::vector<BackupInfo> ListBackups(const std::string& backup_dir);
+
+/**
+ * 오래된 백업 정리 (공유되지 않는 파일만 삭제)
+ * @param backup_dir 백업 디렉토리
+ * @param num_backups_to_keep 유지할 최근 백업 수
+ * @return 성공시 true
  */
-std::unique_ptr<IStorage> CreateStorage();
+bool PurgeOldBackups(const std::string& backup_dir, uint32_t num_backups_to_keep);
 
 } // namespace durastash
 
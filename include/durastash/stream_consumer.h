@@ -0,0 +1,60 @@
+#pragma once
+
+#include "durastash/cursor.h"
+#include "durastash/dedup_manager.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace durastash {
+
+/**
+ * 스트리밍 소비자
+ * 그룹의 현재 세션 데이터 키를 장기 보유 테일링 커서로 따라가며
+ * 마지막으로 전달한 위치 이후에 추가된 데이터만 반환
+ * (매 조회마다 접두사 처음부터 새 반복자로 다시 읽지 않음)
+ *
+ * 휘발성 읽기이며 배치 상태(PENDING/LOADED)를 변경하지 않음
+ * GroupStorage::CreateConsumer로 생성하고, 저장소 종료 전에 해제해야 함
+ * 단일 스레드에서만 사용해야 함
+ */
+class StreamConsumer {
+public:
+    /**
+     * 생성자
+     * @param cursor 데이터 키 범위 커서
+     * @param data_prefix 데이터 키 접두사 (group_key:session_id:)
+     * @param dedup_manager 중복 제거 참조 해석용 (nullptr 허용)
+     * @param checksums 값 끝의 레코드 CRC32C 검증 여부 (불일치 시 CorruptedBatchException)
+     */
+    StreamConsumer(std::unique_ptr<ICursor> cursor,
+                   std::string data_prefix,
+                   DedupManager* dedup_manager,
+                   bool checksums = false);
+
+    /**
+     * 마지막 전달 위치 이후의 새 데이터 조회
+     * @param max_count 최대 개수 (0이면 제한 없음)
+     * @return 데이터 목록 (FIFO 순서, 새 데이터가 없으면 비어 있음)
+     */
+    std::vector<std::string> Poll(size_t max_count = 0);
+
+    /**
+     * 마지막으로 전달한 데이터의 시퀀스 ID
+     * @return 시퀀스 ID (아직 전달한 데이터가 없으면 -1)
+     */
+    int64_t GetLastSequence() const {
+        return last_sequence_;
+    }
+
+private:
+    std::unique_ptr<ICursor> cursor_;
+    std::string data_prefix_;
+    DedupManager* dedup_manager_;
+    bool checksums_;
+    std::string last_key_;
+    int64_t last_sequence_ = -1;
+};
+
+} // namespace durastash
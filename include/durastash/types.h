@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <cstdint>
 #include "jsonable/Jsonable.hpp"
 
@@ -51,6 +52,12 @@ public:
     int64_t GetLoadedAt() const { return loaded_at_; }
     void SetLoadedAt(int64_t timestamp) { loaded_at_ = timestamp; }
 
+    const std::string& GetSegment() const { return segment_; }
+    void SetSegment(const std::string& segment) { segment_ = segment; }
+
+    bool HasChecksums() const { return checksums_; }
+    void SetChecksums(bool checksums) { checksums_ = checksums; }
+
     // jsonable 인터페이스 구현
     void saveToJson() override {
         setString("batch_id", batch_id_);
@@ -61,6 +68,12 @@ public:
         if (loaded_at_ > 0) {
             setInt64("loaded_at", loaded_at_);
         }
+        if (!segment_.empty()) {
+            setString("segment", segment_);
+        }
+        if (checksums_) {
+            setString("checksum", "crc32c");
+        }
     }
 
     void loadFromJson() override {
@@ -74,6 +87,12 @@ public:
         } else {
             loaded_at_ = 0;
         }
+        if (hasKey("segment")) {
+            segment_ = getString("segment");
+        } else {
+            segment_.clear();
+        }
+        checksums_ = hasKey("checksum") && getString("checksum") == "crc32c";
     }
 
 private:
@@ -83,6 +102,8 @@ private:
     BatchStatus status_ = BatchStatus::PENDING;
     int64_t created_at_ = 0;
     int64_t loaded_at_ = 0;     // 0이면 미설정
+    std::string segment_;       // 콜드 티어 세그먼트 파일 이름 (비어 있으면 주 저장소에 있음)
+    bool checksums_ = false;    // 데이터 값 끝에 페이로드 CRC32C 4바이트 포함 여부
 
     static std::string StatusToString(BatchStatus status) {
         switch (status) {
@@ -165,5 +186,15 @@ private:
     }
 };
 
+/**
+ * 배치 로드 결과
+ */
+struct BatchLoadResult {
+    std::string batch_id;              // 배치 ID
+    std::vector<std::string> data;      // 데이터 목록
+    int64_t sequence_start;             // 시퀀스 시작
+    int64_t sequence_end;               // 시퀀스 종료
+};
+
 } // namespace durastash
 
@@ -31,6 +31,14 @@ public:
      */
     static std::string Generate(uint64_t timestamp);
 
+    /**
+     * 단조 증가 ULID 생성
+     * 같은 밀리초(또는 시계 역행) 내에서는 직전 값의 랜덤 부분을 1 증가시켜
+     * 프로세스 내에서 생성 순서와 사전순이 항상 일치하도록 보장
+     * @return ULID 문자열
+     */
+    static std::string GenerateMonotonic();
+
     /**
      * ULID에서 타임스탬프 추출
      * @param ulid ULID 문자열
@@ -56,6 +64,7 @@ private:
     
     static void EncodeTimestamp(uint64_t timestamp, char* buffer);
     static void EncodeRandom(char* buffer);
+    static void Increment(std::string& ulid);
     static uint64_t DecodeTimestamp(const std::string& ulid);
     static uint64_t DecodeBase32(const std::string& str, size_t start, size_t length);
 };
@@ -1,7 +1,8 @@
 #include "durastash/batch_manager.h"
 #include "durastash/errors.h"
-#include <sstream>
-#include <iomanip>
+#include "durastash/checksum.h"
+#include "durastash/key_format.h"
+#include "durastash/metadata_scan.h"
 #include <algorithm>
 
 namespace durastash {
@@ -21,19 +22,10 @@ std::string BatchManager::CreateBatch(const std::string& group_key,
     }
 
     // 새 배치 ID 생성
-    std::string batch_id = ULID::Generate();
+    std::string batch_id = ULID::GenerateMonotonic();
 
-    // 배치 메타데이터 생성
-    BatchMetadata metadata;
-    metadata.SetBatchId(batch_id);
-    metadata.SetSequenceStart(sequence_start);
-    metadata.SetSequenceEnd(sequence_end);
-    metadata.SetStatus(BatchStatus::PENDING);
-    metadata.SetCreatedAt(ULID::Now());
-    metadata.SetLoadedAt(0);
-
-    // JSON 직렬화
-    std::string json_str = metadata.toJson();
+    // 배치 메타데이터 생성 및 JSON 직렬화
+    std::string json_str = MakeNewBatchMetadata(batch_id, sequence_start, sequence_end);
     
     // 저장소에 저장
     std::string key = MakeBatchMetadataKey(group_key, session_id, batch_id);
@@ -44,6 +36,41 @@ std::string BatchManager::CreateBatch(const std::string& group_key,
     return batch_id;
 }
 
+std::string BatchManager::CreateBatchInWriteBatch(const std::string& group_key,
+                                                  const std::string& session_id,
+                                                  int64_t sequence_start,
+                                                  int64_t sequence_end) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!storage_) {
+        return "";
+    }
+
+    // 새 배치 ID 생성
+    std::string batch_id = ULID::GenerateMonotonic();
+
+    // 배치 메타데이터를 진행 중인 배치 쓰기에 추가
+    std::string json_str = MakeNewBatchMetadata(batch_id, sequence_start, sequence_end);
+    storage_->PutToBatch(MakeBatchMetadataKey(group_key, session_id, batch_id), json_str);
+
+    return batch_id;
+}
+
+std::string BatchManager::MakeNewBatchMetadata(const std::string& batch_id,
+                                               int64_t sequence_start,
+                                               int64_t sequence_end) {
+    BatchMetadata metadata;
+    metadata.SetBatchId(batch_id);
+    metadata.SetSequenceStart(sequence_start);
+    metadata.SetSequenceEnd(sequence_end);
+    metadata.SetStatus(BatchStatus::PENDING);
+    metadata.SetCreatedAt(ULID::Now());
+    metadata.SetLoadedAt(0);
+    metadata.SetChecksums(checksums_enabled_);
+
+    return metadata.toJson();
+}
+
 bool BatchManager::GetBatchMetadata(const std::string& group_key,
                                     const std::string& session_id,
                                     const std::string& batch_id,
@@ -103,7 +130,8 @@ bool BatchManager::MarkBatchAsLoaded(const std::string& group_key,
 
 bool BatchManager::AcknowledgeBatch(const std::string& group_key,
                                     const std::string& session_id,
-                                    const std::string& batch_id) {
+                                    const std::string& batch_id,
+                                    size_t* deleted_keys) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (!storage_) {
@@ -142,11 +170,33 @@ bool BatchManager::AcknowledgeBatch(const std::string& group_key,
                     data_keys);
 
     for (const auto& data_key : data_keys) {
+        // 중복 제거된 페이로드는 참조 카운트 감소
+        if (dedup_manager_ && dedup_manager_->IsEnabled()) {
+            std::string value;
+            uint32_t checksum = 0;
+            if (storage_->Get(data_key, value) &&
+                (!metadata.HasChecksums() || Checksum::SplitRecordChecksum(value, checksum))) {
+                dedup_manager_->ReleaseToBatch(value);
+            }
+        }
         storage_->DeleteFromBatch(data_key);
     }
 
     // 배치 커밋
-    return storage_->CommitBatch();
+    if (!storage_->CommitBatch()) {
+        return false;
+    }
+
+    // 참조 카운트가 0이 된 페이로드 정리
+    if (dedup_manager_ && dedup_manager_->IsEnabled()) {
+        dedup_manager_->CollectGarbage();
+    }
+
+    if (deleted_keys) {
+        *deleted_keys = data_keys.size() + 1;
+    }
+
+    return true;
 }
 
 size_t BatchManager::GetLoadableBatches(const std::string& group_key,
@@ -172,6 +222,20 @@ size_t BatchManager::GetLoadableBatches(const std::string& group_key,
     std::vector<std::pair<std::string, int64_t>> pending_batches;
     
     for (size_t i = 0; i < keys.size(); ++i) {
+        // 원시 바이트에서 상태를 먼저 확인해 PENDING이 아닌 배치는 파싱하지 않음
+        // (배치 ID는 키의 마지막 부분과 같음)
+        BatchStatus status;
+        int64_t sequence_start = 0;
+        if (MetadataScan::ProbeStatus(values[i], status)) {
+            if (status != BatchStatus::PENDING) {
+                continue;
+            }
+            if (MetadataScan::ProbeInt64(values[i], "sequence_start", sequence_start)) {
+                pending_batches.push_back({keys[i].substr(prefix.size()), sequence_start});
+                continue;
+            }
+        }
+
         BatchMetadata metadata;
         metadata.fromJson(values[i]);
         
@@ -220,10 +284,11 @@ std::string BatchManager::MakeDataKey(const std::string& group_key,
                                      const std::string& session_id,
                                      const std::string& batch_id,
                                      int64_t sequence_id) {
-    std::ostringstream oss;
-    oss << group_key << ":" << session_id << ":" << batch_id << ":";
-    oss << std::setfill('0') << std::setw(20) << sequence_id;
-    return oss.str();
+    std::string key;
+    key.reserve(group_key.size() + session_id.size() + batch_id.size() + 3 + KeyFormat::SEQUENCE_DIGITS);
+    key.append(group_key).append(1, ':').append(session_id).append(1, ':').append(batch_id).append(1, ':');
+    KeyFormat::AppendSequence(key, sequence_id);
+    return key;
 }
 
 std::string BatchManager::FindBatchIdBySequenceId(const std::string& group_key,
@@ -244,6 +309,17 @@ std::string BatchManager::FindBatchIdBySequenceId(const std::string& group_key,
 
     // sequence_id가 포함된 배치 찾기
     for (size_t i = 0; i < keys.size(); ++i) {
+        // 원시 바이트에서 범위를 확인해 후보 배치가 아니면 파싱하지 않음
+        int64_t sequence_start = 0;
+        int64_t sequence_end = 0;
+        if (MetadataScan::ProbeInt64(values[i], "sequence_start", sequence_start) &&
+            MetadataScan::ProbeInt64(values[i], "sequence_end", sequence_end)) {
+            if (sequence_id >= sequence_start && sequence_id <= sequence_end) {
+                return keys[i].substr(prefix.size());
+            }
+            continue;
+        }
+
         BatchMetadata metadata;
         try {
             metadata.fromJson(values[i]);
@@ -0,0 +1,231 @@
+#include "durastash/checksum.h"
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <nmmintrin.h>
+#define DURASTASH_CRC32C_SSE42 1
+#define DURASTASH_SSE42_TARGET __attribute__((target("sse4.2")))
+#elif defined(_M_X64)
+#include <intrin.h>
+#include <nmmintrin.h>
+#define DURASTASH_CRC32C_SSE42 1
+#define DURASTASH_SSE42_TARGET
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define DURASTASH_CRC32C_ARM 1
+#endif
+
+namespace durastash {
+
+namespace {
+
+// CRC32C 다항식 (반사 표현)
+constexpr uint32_t kPolynomial = 0x82F63B78;
+
+// slicing-by-8 테이블 (컴파일 타임 생성)
+constexpr std::array<std::array<uint32_t, 256>, 8> MakeTables() {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1) ? kPolynomial : 0);
+        }
+        tables[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+        for (size_t t = 1; t < 8; ++t) {
+            tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+        }
+    }
+    return tables;
+}
+
+constexpr auto kTables = MakeTables();
+
+// 리틀 엔디언 읽기 (x86/ARM 기준, 정렬되지 않은 주소 허용)
+inline uint64_t Read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// 아래 Extend* 함수는 반전하지 않은 내부 상태를 이어서 계산
+uint32_t ExtendPortable(uint32_t state, const uint8_t* p, size_t length) {
+    while (length >= 8) {
+        uint64_t word = Read64(p) ^ state;
+        state = kTables[7][word & 0xFF] ^ kTables[6][(word >> 8) & 0xFF] ^
+                kTables[5][(word >> 16) & 0xFF] ^ kTables[4][(word >> 24) & 0xFF] ^
+                kTables[3][(word >> 32) & 0xFF] ^ kTables[2][(word >> 40) & 0xFF] ^
+                kTables[1][(word >> 48) & 0xFF] ^ kTables[0][word >> 56];
+        p += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        state = (state >> 8) ^ kTables[0][(state ^ *p++) & 0xFF];
+    }
+    return state;
+}
+
+#if defined(DURASTASH_CRC32C_SSE42)
+
+bool DetectHardware() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;
+#else
+    return __builtin_cpu_supports("sse4.2");
+#endif
+}
+
+DURASTASH_SSE42_TARGET
+inline uint32_t HardwareStep64(uint32_t state, const uint8_t* p) {
+#if defined(__x86_64__) || defined(_M_X64)
+    return static_cast<uint32_t>(_mm_crc32_u64(state, Read64(p)));
+#else
+    state = _mm_crc32_u32(state, static_cast<uint32_t>(Read64(p)));
+    return _mm_crc32_u32(state, static_cast<uint32_t>(Read64(p) >> 32));
+#endif
+}
+
+DURASTASH_SSE42_TARGET
+inline uint32_t HardwareStep8(uint32_t state, uint8_t byte) {
+    return _mm_crc32_u8(state, byte);
+}
+
+#elif defined(DURASTASH_CRC32C_ARM)
+
+bool DetectHardware() {
+    return true;  // 컴파일러가 CRC 확장을 대상으로 빌드한 경우에만 이 경로 사용
+}
+
+inline uint32_t HardwareStep64(uint32_t state, const uint8_t* p) {
+    return __crc32cd(state, Read64(p));
+}
+
+inline uint32_t HardwareStep8(uint32_t state, uint8_t byte) {
+    return __crc32cb(state, byte);
+}
+
+#endif
+
+#if defined(DURASTASH_CRC32C_SSE42) || defined(DURASTASH_CRC32C_ARM)
+
+#if defined(DURASTASH_CRC32C_SSE42)
+DURASTASH_SSE42_TARGET
+#endif
+uint32_t ExtendHardware(uint32_t state, const uint8_t* p, size_t length) {
+    while (length >= 8) {
+        state = HardwareStep64(state, p);
+        p += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        state = HardwareStep8(state, *p++);
+    }
+    return state;
+}
+
+// 레코드 3개를 8바이트 단위로 교차 계산 (CRC 명령의 3사이클 지연시간 동안 독립 명령 실행)
+#if defined(DURASTASH_CRC32C_SSE42)
+DURASTASH_SSE42_TARGET
+#endif
+void ExtendHardware3(const std::string* payloads, uint32_t* crcs) {
+    const uint8_t* p0 = reinterpret_cast<const uint8_t*>(payloads[0].data());
+    const uint8_t* p1 = reinterpret_cast<const uint8_t*>(payloads[1].data());
+    const uint8_t* p2 = reinterpret_cast<const uint8_t*>(payloads[2].data());
+    size_t common = payloads[0].size();
+    if (payloads[1].size() < common) common = payloads[1].size();
+    if (payloads[2].size() < common) common = payloads[2].size();
+    common &= ~static_cast<size_t>(7);
+
+    uint32_t s0 = 0xFFFFFFFFu;
+    uint32_t s1 = 0xFFFFFFFFu;
+    uint32_t s2 = 0xFFFFFFFFu;
+    for (size_t i = 0; i < common; i += 8) {
+        s0 = HardwareStep64(s0, p0 + i);
+        s1 = HardwareStep64(s1, p1 + i);
+        s2 = HardwareStep64(s2, p2 + i);
+    }
+
+    crcs[0] = ~ExtendHardware(s0, p0 + common, payloads[0].size() - common);
+    crcs[1] = ~ExtendHardware(s1, p1 + common, payloads[1].size() - common);
+    crcs[2] = ~ExtendHardware(s2, p2 + common, payloads[2].size() - common);
+}
+
+const bool kHardwareAvailable = DetectHardware();
+
+#else
+
+const bool kHardwareAvailable = false;
+
+#endif
+
+} // anonymous namespace
+
+uint32_t Checksum::Crc32c(const void* data, size_t length, uint32_t crc) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+#if defined(DURASTASH_CRC32C_SSE42) || defined(DURASTASH_CRC32C_ARM)
+    if (kHardwareAvailable) {
+        return ~ExtendHardware(~crc, p, length);
+    }
+#endif
+    return ~ExtendPortable(~crc, p, length);
+}
+
+uint32_t Checksum::Crc32cPortable(const void* data, size_t length, uint32_t crc) {
+    return ~ExtendPortable(~crc, static_cast<const uint8_t*>(data), length);
+}
+
+bool Checksum::IsHardwareAccelerated() {
+    return kHardwareAvailable;
+}
+
+size_t Checksum::VerifyBatch(const std::string* payloads, const uint32_t* expected, size_t count) {
+    size_t i = 0;
+#if defined(DURASTASH_CRC32C_SSE42) || defined(DURASTASH_CRC32C_ARM)
+    if (kHardwareAvailable) {
+        uint32_t crcs[3];
+        for (; i + 3 <= count; i += 3) {
+            ExtendHardware3(payloads + i, crcs);
+            for (size_t k = 0; k < 3; ++k) {
+                if (crcs[k] != expected[i + k]) {
+                    return i + k;
+                }
+            }
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        if (Crc32c(payloads[i]) != expected[i]) {
+            return i;
+        }
+    }
+    return count;
+}
+
+void Checksum::AppendRecordChecksum(std::string& stored_value, std::string_view payload) {
+    uint32_t crc = Crc32c(payload);
+    char bytes[RECORD_CHECKSUM_SIZE];
+    for (size_t i = 0; i < RECORD_CHECKSUM_SIZE; ++i) {
+        bytes[i] = static_cast<char>((crc >> (8 * i)) & 0xFF);
+    }
+    stored_value.append(bytes, RECORD_CHECKSUM_SIZE);
+}
+
+bool Checksum::SplitRecordChecksum(std::string& stored_value, uint32_t& expected) {
+    if (stored_value.size() < RECORD_CHECKSUM_SIZE) {
+        return false;
+    }
+
+    size_t offset = stored_value.size() - RECORD_CHECKSUM_SIZE;
+    expected = 0;
+    for (size_t i = 0; i < RECORD_CHECKSUM_SIZE; ++i) {
+        expected |= static_cast<uint32_t>(static_cast<uint8_t>(stored_value[offset + i])) << (8 * i);
+    }
+    stored_value.resize(offset);
+    return true;
+}
+
+} // namespace durastash
@@ -0,0 +1,153 @@
+#include "durastash/dedup_manager.h"
+#include "durastash/hash.h"
+#include <chrono>
+
+namespace durastash {
+
+namespace {
+
+// 해시 참조 값 접두사 (일반 페이로드와 구분하기 위해 NUL 바이트로 시작)
+const std::string kReferenceMarker("\0DSREF:", 7);
+
+// 128비트 콘텐츠 해시를 위한 두 번째 시드
+constexpr uint64_t kSecondarySeed = 0x9E3779B97F4A7C15ULL;
+
+} // namespace
+
+DedupManager::DedupManager(IStorage* storage, size_t min_size)
+    : storage_(storage)
+    , min_size_(min_size) {
+}
+
+std::string DedupManager::EncodeToBatch(std::string_view data) {
+    auto hash_start = std::chrono::steady_clock::now();
+    std::string content_hash = ComputeContentHash(data);
+    auto hash_end = std::chrono::steady_clock::now();
+
+    std::string ref_count_key = MakeRefCountKey(content_hash);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // 이미 참조 중이거나 같은 배치에서 추가된 페이로드가 없을 때만 본문 저장
+    bool exists = batch_hashes_.count(content_hash) > 0;
+    if (!exists) {
+        int64_t ref_count = 0;
+        exists = storage_->GetCounter(ref_count_key, ref_count) && ref_count > 0;
+    }
+    if (!exists) {
+        storage_->PutToBatch(MakeBlobKey(content_hash), data);
+        batch_hashes_.insert(content_hash);
+    }
+    storage_->MergeCounterToBatch(ref_count_key, 1);
+
+    stats_.payload_bytes += data.size();
+    stats_.hash_time_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+        hash_end - hash_start).count();
+    if (exists) {
+        stats_.deduplicated_count++;
+    } else {
+        stats_.stored_bytes += data.size();
+    }
+    // 해제 후 다시 참조된 경우 삭제 대상에서 제외
+    released_hashes_.erase(content_hash);
+
+    return kReferenceMarker + content_hash;
+}
+
+void DedupManager::FinishBatch() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batch_hashes_.clear();
+}
+
+bool DedupManager::IsReference(const std::string& stored_value) {
+    return stored_value.size() == kReferenceMarker.size() + 2 * Hash::HEX64_LENGTH &&
+           stored_value.compare(0, kReferenceMarker.size(), kReferenceMarker) == 0;
+}
+
+bool DedupManager::Resolve(std::string& value) {
+    if (!IsEnabled() || value.empty() || value.front() != '\0') {
+        return true;
+    }
+
+    // NUL 바이트로 시작하는 일반 페이로드는 NUL 바이트 하나가 더 붙어 저장됨
+    if (value.size() > 1 && value[1] == '\0') {
+        value.erase(0, 1);
+        return true;
+    }
+    if (!IsReference(value)) {
+        return true;
+    }
+
+    std::string content_hash = value.substr(kReferenceMarker.size());
+    return storage_->Get(MakeBlobKey(content_hash), value);
+}
+
+void DedupManager::ReleaseToBatch(const std::string& stored_value) {
+    if (!IsReference(stored_value)) {
+        return;
+    }
+
+    std::string content_hash = stored_value.substr(kReferenceMarker.size());
+    storage_->MergeCounterToBatch(MakeRefCountKey(content_hash), -1);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    released_hashes_.insert(content_hash);
+}
+
+size_t DedupManager::CollectGarbage() {
+    std::unordered_set<std::string> candidates;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        candidates.swap(released_hashes_);
+    }
+
+    if (candidates.empty()) {
+        return 0;
+    }
+
+    if (!storage_->BeginBatch()) {
+        // 다음 호출에서 다시 시도
+        std::lock_guard<std::mutex> lock(mutex_);
+        released_hashes_.insert(candidates.begin(), candidates.end());
+        return 0;
+    }
+
+    size_t collected = 0;
+    for (const auto& content_hash : candidates) {
+        std::string ref_count_key = MakeRefCountKey(content_hash);
+        int64_t ref_count = 0;
+        if (storage_->GetCounter(ref_count_key, ref_count) && ref_count > 0) {
+            continue;  // 아직 참조 중
+        }
+
+        storage_->DeleteFromBatch(MakeBlobKey(content_hash));
+        storage_->DeleteFromBatch(ref_count_key);
+        collected++;
+    }
+
+    if (!storage_->CommitBatch()) {
+        return 0;
+    }
+
+    return collected;
+}
+
+DedupStats DedupManager::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+std::string DedupManager::ComputeContentHash(std::string_view data) {
+    // 64비트 해시 두 개를 이어 붙여 128비트 콘텐츠 주소로 사용 (충돌 확률 최소화)
+    return Hash::ToHex(Hash::XXH64(data)) + Hash::ToHex(Hash::XXH64(data, kSecondarySeed));
+}
+
+std::string DedupManager::MakeBlobKey(const std::string& content_hash) {
+    return "__durastash__:blob:" + content_hash;
+}
+
+std::string DedupManager::MakeRefCountKey(const std::string& content_hash) {
+    return "__durastash__:blobref:" + content_hash;
+}
+
+} // namespace durastash
@@ -1,16 +1,109 @@
 #include "durastash/group_storage.h"
 #include "durastash/storage.h"
 #include "durastash/errors.h"
+#include "durastash/replay_segment.h"
+#include "durastash/checksum.h"
+#include "durastash/key_format.h"
+#include "durastash/metadata_scan.h"
 #include <algorithm>
+#include <limits>
+#include <filesystem>
+#include <unordered_set>
+#include <chrono>
+#include <charconv>
 
 namespace durastash {
 
-GroupStorage::GroupStorage(const std::string& db_path)
+namespace {
+
+// 시스템 예약 그룹 키 (내부 메타데이터 저장용, 사용자 그룹으로 사용 불가)
+const std::string kSystemGroupKey = "__durastash__";
+
+// 그룹 레지스트리 키 접두사: __durastash__:group:<group_key>
+const std::string kGroupRegistryPrefix = kSystemGroupKey + ":group:";
+
+// 콜드 티어 세그먼트 참조 카운트 키 접두사: __durastash__:segment:<group_key>:<segment>
+const std::string kSegmentRefPrefix = kSystemGroupKey + ":segment:";
+
+// 프로듀서 high-water mark 키 접두사: __durastash__:producer:<group_key 길이>:<group_key>:<producer_id>
+// (길이를 붙여 "group_key:xxx" 형태의 하위 그룹 키와 구분)
+const std::string kProducerPrefix = kSystemGroupKey + ":producer:";
+
+// 축출된 유휴 그룹 상태 키 접두사: __durastash__:idle:<group_key>
+// 값: <session_id>:<last_sequence>:<batch_start>:<batch_id> (Save 전이면 last_sequence -1, batch_id 빈 문자열)
+const std::string kIdleGroupPrefix = kSystemGroupKey + ":idle:";
+
+// 세그먼트 파일 확장자 (세그먼트 이름은 <ULID>.sst)
+const std::string kSegmentExtension = ".sst";
+
+// 데이터 키 끝의 시퀀스 ID 자릿수 (0으로 채운 20자리)
+constexpr size_t kSequenceDigits = KeyFormat::SEQUENCE_DIGITS;
+
+// 배치 메타데이터 키 중간 구분자 ("group:session:batch:<batch_id>")
+const std::string kBatchMetadataInfix = "batch:";
+
+// 누적 ACK 워터마크 키 접미사 ("group:session:ack_watermark", 값은 ACK된 마지막 시퀀스)
+// 소문자로 시작하므로 데이터 키 범위 [group:session:, group:session:a) 밖에 정렬됨
+const std::string kAckWatermarkSuffix = "ack_watermark";
+
+/**
+ * 내보낸 파일의 키에서 "group:session:" 접두사 추출
+ * 데이터 키: group:session:<batch_id>:<seq 20자리>, 메타데이터 키: group:session:batch:<batch_id>
+ */
+bool ParseSessionPrefix(std::string_view key, std::string& session_prefix) {
+    const size_t metadata_suffix = kBatchMetadataInfix.size() + ULID::ULID_LENGTH;
+    const size_t data_suffix = ULID::ULID_LENGTH + 1 + kSequenceDigits;
+    
+    size_t prefix_length = 0;
+    if (key.size() > metadata_suffix &&
+        key.compare(key.size() - metadata_suffix, kBatchMetadataInfix.size(), kBatchMetadataInfix) == 0) {
+        prefix_length = key.size() - metadata_suffix;
+    } else if (key.size() > data_suffix) {
+        prefix_length = key.size() - data_suffix;
+    } else {
+        return false;
+    }
+
+    // 접두사는 최소 "g:" + 세션 ID + ":" 형식이어야 함
+    if (prefix_length < ULID::ULID_LENGTH + 3 || key[prefix_length - 1] != ':' ||
+        key[prefix_length - ULID::ULID_LENGTH - 2] != ':') {
+        return false;
+    }
+    session_prefix.assign(key.data(), prefix_length);
+    return true;
+}
+
+/**
+ * 시스템 키 공간과 겹치는 그룹 키인지 확인
+ * "__durastash__" 자체와 "__durastash__:" 로 시작하는 키는 그룹 범위가 시스템 키(blob, 레지스트리 등)를 포함하므로 예약됨
+ */
+bool IsReservedGroupKey(std::string_view group_key) {
+    return group_key.compare(0, kSystemGroupKey.size(), kSystemGroupKey) == 0 &&
+           (group_key.size() == kSystemGroupKey.size() || group_key[kSystemGroupKey.size()] == ':');
+}
+
+int64_t SteadyNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool ParseInt64(std::string_view text, int64_t& value) {
+    auto [next, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc() && next == text.data() + text.size();
+}
+
+} // namespace
+
+GroupStorage::GroupStorage(const std::string& db_path, const StorageOptions& options)
     : default_batch_size_(100)
-    , db_path_(db_path) {
-    storage_ = CreateStorage();
+    , db_path_(db_path)
+    , options_(options) {
+    storage_ = CreateStorage(options_);
     session_manager_ = std::make_unique<SessionManager>(storage_.get());
     batch_manager_ = std::make_unique<BatchManager>(storage_.get());
+    dedup_manager_ = std::make_unique<DedupManager>(storage_.get(), options_.dedup_min_size);
+    batch_manager_->SetDedupManager(dedup_manager_.get());
+    batch_manager_->SetChecksumsEnabled(options_.enable_checksums);
 }
 
 GroupStorage::~GroupStorage() {
@@ -24,11 +117,63 @@ bool GroupStorage::Initialize() {
         return false;
     }
 
-    return storage_->Initialize(db_path_);
+    if (!storage_->Initialize(db_path_)) {
+        return false;
+    }
+    shutting_down_ = false;
+
+    // 이전 프로세스가 축출한 그룹 상태는 세션이 이어지지 않으므로 제거
+    std::string idle_end = kIdleGroupPrefix;
+    idle_end.back() = ';';
+    auto idle_cursor = storage_->NewCursor(kIdleGroupPrefix, idle_end, false);
+    if (idle_cursor) {
+        idle_cursor->Seek(kIdleGroupPrefix);
+        if (idle_cursor->Valid()) {
+            storage_->DeleteRange(kIdleGroupPrefix, idle_end);
+        }
+    }
+    has_evicted_groups_ = false;
+
+    // 그룹 레지스트리는 필요할 때 저장소에서 직접 조회하므로 오픈 시 읽지 않음
+    return true;
+}
+
+void GroupStorage::WaitForRecovery() {
+    // 오픈 후 백그라운드에서 복구할 메모리 상태가 없음 (지연 복구 옵션 호환용)
+}
+
+GroupStorage::StorageUse::~StorageUse() {
+    if (owner_) {
+        std::lock_guard<std::mutex> lock(owner_->mutex_);
+        if (--owner_->storage_users_ == 0) {
+            owner_->storage_users_cv_.notify_all();
+        }
+    }
+}
+
+bool GroupStorage::StorageUse::BeginLocked(GroupStorage* owner) {
+    if (owner->shutting_down_ || !owner->storage_) {
+        return false;
+    }
+    owner->storage_users_++;
+    owner_ = owner;
+    return true;
 }
 
 void GroupStorage::Shutdown() {
-    std::lock_guard<std::mutex> lock(mutex_);
+    // 잠금 밖에서 저장소를 사용하는 새 작업 거부
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutting_down_ = true;
+    }
+
+    // 저장소 종료 전에 진행 중인 헤드 컴팩션 완료 대기
+    StopCompactionThread();
+    StopIdleEvictionThread();
+    StopLoadThreads();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    storage_users_cv_.wait(lock, [this] { return storage_users_ == 0; });
     
     // 모든 그룹의 세션 종료
     for (const auto& pair : group_sessions_) {
@@ -43,15 +188,29 @@ void GroupStorage::Shutdown() {
     
     group_sessions_.clear();
     group_sequence_counters_.clear();
+    group_current_batch_ids_.clear();
+    producer_high_water_marks_.clear();
+    head_compaction_states_.clear();
+    group_last_access_ms_.clear();
+    has_evicted_groups_ = false;
 }
 
 bool GroupStorage::InitializeSession(const std::string& group_key) {
     std::lock_guard<std::mutex> lock(mutex_);
     
+    return InitializeSessionLocked(group_key);
+}
+
+bool GroupStorage::InitializeSessionLocked(const std::string& group_key) {
     if (!storage_ || !session_manager_) {
         return false;
     }
 
+    // 그룹 레지스트리 등록
+    if (!RegisterGroup(group_key)) {
+        return false;
+    }
+
     // 세션 초기화
     if (!session_manager_->InitializeSession(group_key)) {
         return false;
@@ -59,9 +218,16 @@ bool GroupStorage::InitializeSession(const std::string& group_key) {
 
     std::string session_id = session_manager_->GetSessionId();
     group_sessions_[group_key] = session_id;
+    group_last_access_ms_[group_key] = SteadyNowMs();
     
     // 하트비트 스레드 시작 (한 번만)
     session_manager_->StartHeartbeatThread(5000);
+
+    // 유휴 그룹 축출 스레드 시작 (한 번만)
+    if (options_.idle_group_timeout_ms > 0 && !idle_eviction_running_) {
+        idle_eviction_running_ = true;
+        idle_eviction_thread_ = std::thread(&GroupStorage::IdleEvictionWorker, this);
+    }
     
     return true;
 }
@@ -69,12 +235,14 @@ bool GroupStorage::InitializeSession(const std::string& group_key) {
 void GroupStorage::TerminateSession(const std::string& group_key) {
     std::lock_guard<std::mutex> lock(mutex_);
     
+    DiscardEvictedGroup(group_key);
     session_manager_->TerminateSession(group_key);
     group_sessions_.erase(group_key);
     group_sequence_counters_.erase(group_key);
+    group_last_access_ms_.erase(group_key);
 }
 
-bool GroupStorage::Save(const std::string& group_key, const std::string& data) {
+bool GroupStorage::Save(const std::string& group_key, std::string_view data) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (!storage_ || !batch_manager_) {
@@ -87,43 +255,131 @@ bool GroupStorage::Save(const std::string& group_key, const std::string& data) {
         return false;
     }
 
-    // 다음 시퀀스 ID 획득
-    int64_t sequence_id = GetNextSequenceId(group_key);
-    
-    // 현재 배치의 시퀀스 범위 계산
-    int64_t batch_start = (sequence_id / default_batch_size_) * default_batch_size_;
-    int64_t batch_end = batch_start + default_batch_size_ - 1;
+    // 데이터 키 할당 및 저장
+    std::string data_key = AllocateDataKey(group_key, session_id);
+    if (data_key.empty()) {
+        return false;
+    }
+
+    return PutPayload(data_key, data);
+}
+
+bool GroupStorage::Save(const std::string& group_key,
+                        std::string_view data,
+                        const std::string& producer_id,
+                        int64_t producer_seq) {
+    std::lock_guard<std::mutex> lock(mutex_);
     
-    // 배치 키 생성 (그룹별 현재 배치 추적용)
-    std::string batch_key = group_key + ":" + std::to_string(batch_start);
+    if (!storage_ || !batch_manager_) {
+        return false;
+    }
+
+    // 세션 확인 및 생성
+    std::string session_id = GetOrCreateSession(group_key);
+    if (session_id.empty()) {
+        return false;
+    }
+
+    // 프로듀서 high-water mark 이하의 시퀀스는 재시도된 중복이므로 저장하지 않음
+    std::string producer_key = MakeProducerKey(group_key, producer_id);
+    if (producer_seq <= GetProducerHighWaterMark(producer_key)) {
+        return true;
+    }
+
+    // 데이터 키 할당
+    std::string data_key = AllocateDataKey(group_key, session_id);
+    if (data_key.empty()) {
+        return false;
+    }
+
+    // 데이터와 high-water mark를 원자적으로 저장
+    if (!storage_->BeginBatch()) {
+        return false;
+    }
+
+    PutPayloadToBatch(data_key, data);
+    storage_->PutToBatch(producer_key, std::to_string(producer_seq));
+
+    bool committed = storage_->CommitBatch();
+    dedup_manager_->FinishBatch();
+    if (!committed) {
+        return false;
+    }
+
+    // 캐시 크기 제한 (제거된 항목은 다음 사용 시 저장소에서 다시 로드)
+    if (producer_high_water_marks_.size() >= kMaxCachedProducers &&
+        producer_high_water_marks_.find(producer_key) == producer_high_water_marks_.end()) {
+        producer_high_water_marks_.erase(producer_high_water_marks_.begin());
+    }
+    producer_high_water_marks_[producer_key] = producer_seq;
+    return true;
+}
+
+bool GroupStorage::SaveMulti(std::span<const std::pair<std::string, std::string>> entries) {
+    return SaveMultiEntries(entries);
+}
+
+bool GroupStorage::SaveMulti(std::span<const std::pair<std::string, std::string_view>> entries) {
+    return SaveMultiEntries(entries);
+}
+
+template <typename Entry>
+bool GroupStorage::SaveMultiEntries(std::span<const Entry> entries) {
+    std::lock_guard<std::mutex> lock(mutex_);
     
-    // 배치가 새로 시작되는 경우 배치 생성
-    std::string batch_id;
-    auto batch_it = group_current_batch_ids_.find(batch_key);
-    if (batch_it == group_current_batch_ids_.end()) {
-        batch_id = batch_manager_->CreateBatch(group_key, session_id, 
-                                              batch_start, batch_end);
-        if (batch_id.empty()) {
+    if (!storage_ || !batch_manager_) {
+        return false;
+    }
+
+    if (entries.empty()) {
+        return true;
+    }
+
+    // 모든 그룹의 세션을 배치 쓰기 시작 전에 확보
+    std::vector<std::string> session_ids;
+    session_ids.reserve(entries.size());
+    for (const auto& [group_key, data] : entries) {
+        std::string session_id = GetOrCreateSession(group_key);
+        if (session_id.empty()) {
             return false;
         }
-        group_current_batch_ids_[batch_key] = batch_id;
-    } else {
-        batch_id = batch_it->second;
+        session_ids.push_back(session_id);
     }
 
-    // 데이터 키 생성 및 저장
-    std::vector<std::string> data_keys;
-    batch_manager_->GenerateDataKeys(group_key, session_id, batch_id,
-                                     sequence_id, sequence_id, data_keys);
-    
-    if (data_keys.empty()) {
+    // 배치 쓰기 시작
+    if (!storage_->BeginBatch()) {
+        return false;
+    }
+
+    // 그룹별 시퀀스 할당 후 데이터와 새 배치 메타데이터를 하나의 배치에 추가
+    std::vector<std::string> created_batch_keys;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        std::string data_key = AllocateDataKey(entries[i].first, session_ids[i], &created_batch_keys);
+        if (data_key.empty()) {
+            storage_->RollbackBatch();
+            dedup_manager_->FinishBatch();
+            DiscardBatchKeys(created_batch_keys);
+            return false;
+        }
+        PutPayloadToBatch(data_key, entries[i].second);
+    }
+
+    // 단일 커밋 (동기 쓰기 한 번)
+    bool committed = storage_->CommitBatch();
+    dedup_manager_->FinishBatch();
+    if (!committed) {
+        DiscardBatchKeys(created_batch_keys);
         return false;
     }
 
-    return storage_->Put(data_keys[0], data);
+    return true;
 }
 
 std::vector<std::string> GroupStorage::Load(const std::string& group_key) {
+    return Load(group_key, options_.load_threads);
+}
+
+std::vector<std::string> GroupStorage::Load(const std::string& group_key, size_t num_threads) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     std::vector<std::string> results;
@@ -133,7 +389,7 @@ std::vector<std::string> GroupStorage::Load(const std::string& group_key) {
     }
 
     // 세션 확인
-    auto it = group_sessions_.find(group_key);
+    auto it = FindGroupSession(group_key);
     if (it == group_sessions_.end()) {
         return results;
     }
@@ -152,7 +408,10 @@ std::vector<std::string> GroupStorage::Load(const std::string& group_key) {
     for (size_t i = 0; i < keys.size(); ++i) {
         BatchMetadata metadata;
         try {
-            metadata.fromJson(values[i]);
+            // 기록 형식 그대로면 DOM 없이 디코딩, 아니면 전체 파싱
+            if (!MetadataScan::Decode(values[i], metadata)) {
+                metadata.fromJson(values[i]);
+            }
             batches.push_back({metadata.GetSequenceStart(), metadata});
         } catch (...) {
             continue;
@@ -165,21 +424,18 @@ std::vector<std::string> GroupStorage::Load(const std::string& group_key) {
                   return a.first < b.first;
               });
 
-    // 각 배치의 데이터를 순서대로 로드
+    if (num_threads > 1 && batches.size() > 1) {
+        ReadBatchesParallel(group_key, session_id, batches, std::min(num_threads, batches.size()), results);
+        return results;
+    }
+
+    // 각 배치의 데이터를 순서대로 로드 (하나의 커서로 배치별 범위 순차 읽기, readahead 적용)
+    auto cursor = NewDataCursor(group_key, session_id, false);
+    if (!cursor) {
+        return results;
+    }
     for (const auto& [seq_start, metadata] : batches) {
-        std::vector<std::string> data_keys;
-        batch_manager_->GenerateDataKeys(group_key, session_id, 
-                                         metadata.GetBatchId(),
-                                         metadata.GetSequenceStart(),
-                                         metadata.GetSequenceEnd(),
-                                         data_keys);
-        
-        for (const auto& data_key : data_keys) {
-            std::string value;
-            if (storage_->Get(data_key, value)) {
-                results.push_back(value);
-            }
-        }
+        ReadBatchPayloads(*cursor, group_key, session_id, metadata, results);
     }
 
     return results;
@@ -195,7 +451,7 @@ std::vector<BatchLoadResult> GroupStorage::LoadBatch(const std::string& group_ke
     }
 
     // 세션 확인
-    auto it = group_sessions_.find(group_key);
+    auto it = FindGroupSession(group_key);
     if (it == group_sessions_.end()) {
         return results;
     }
@@ -211,23 +467,112 @@ std::vector<BatchLoadResult> GroupStorage::LoadBatch(const std::string& group_ke
         return results;
     }
 
+    auto cursor = NewDataCursor(group_key, session_id, false);
+    if (!cursor) {
+        return results;
+    }
+
     // 각 배치를 Load
     for (const auto& batch_id : batch_ids) {
+        // 배치 데이터를 먼저 읽어 검증 (손상된 배치가 Loaded 상태로 남지 않도록)
+        BatchLoadResult result;
+        try {
+            if (!LoadBatchData(*cursor, group_key, session_id, batch_id, result)) {
+                continue;
+            }
+        } catch (const CorruptedBatchException&) {
+            // 이미 Loaded로 바꾼 배치가 있으면 먼저 반환하고, 손상 배치는 Pending으로 남겨 다음 호출에서 보고
+            if (results.empty()) {
+                throw;
+            }
+            break;
+        }
+
         // 배치를 Loaded 상태로 변경 (원자적 연산)
         if (!batch_manager_->MarkBatchAsLoaded(group_key, session_id, batch_id)) {
             continue;  // 이미 Loaded 상태면 스킵
         }
-
-        // 배치 데이터 로드
-        BatchLoadResult result;
-        if (LoadBatchData(group_key, session_id, batch_id, result)) {
-            results.push_back(result);
-        }
+        results.push_back(std::move(result));
     }
 
     return results;
 }
 
+bool GroupStorage::LoadBatch(const std::string& group_key, ArenaBatchLoadResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    result.data.Reset();
+
+    if (!storage_ || !batch_manager_) {
+        return false;
+    }
+
+    auto it = FindGroupSession(group_key);
+    if (it == group_sessions_.end()) {
+        return false;
+    }
+
+    const std::string& session_id = it->second;
+
+    std::vector<std::string> batch_ids;
+    if (batch_manager_->GetLoadableBatches(group_key, session_id, 1, batch_ids) == 0) {
+        return false;
+    }
+
+    const std::string& batch_id = batch_ids.front();
+    BatchMetadata metadata;
+    if (!batch_manager_->GetBatchMetadata(group_key, session_id, batch_id, metadata)) {
+        return false;
+    }
+
+    auto cursor = NewDataCursor(group_key, session_id, false);
+    if (!cursor) {
+        return false;
+    }
+
+    result.batch_id = batch_id;
+    result.sequence_start = metadata.GetSequenceStart();
+    result.sequence_end = metadata.GetSequenceEnd();
+
+    // 페이로드를 아레나에 바로 복사 (체크섬은 레코드별로 즉시 검증, 손상 시 Pending 상태로 남음)
+    ForEachBatchRecord(*cursor, group_key, session_id, metadata,
+                       [&result](std::string_view, std::string& value) {
+                           result.data.Append(value);
+                           return true;
+                       });
+
+    // 검증을 마친 뒤 Loaded 상태로 변경
+    if (!batch_manager_->MarkBatchAsLoaded(group_key, session_id, batch_id)) {
+        result.data.Reset();
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<StreamConsumer> GroupStorage::CreateConsumer(const std::string& group_key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!storage_) {
+        return nullptr;
+    }
+
+    // 세션 확인
+    auto it = FindGroupSession(group_key);
+    if (it == group_sessions_.end()) {
+        return nullptr;
+    }
+
+    auto cursor = NewDataCursor(group_key, it->second, true);
+    if (!cursor) {
+        return nullptr;
+    }
+
+    // 현재 세션의 배치는 모두 이 인스턴스가 같은 체크섬 설정으로 생성함
+    return std::make_unique<StreamConsumer>(std::move(cursor), group_key + ":" + it->second + ":",
+                                            dedup_manager_->IsEnabled() ? dedup_manager_.get() : nullptr,
+                                            options_.enable_checksums);
+}
+
 bool GroupStorage::AcknowledgeBatch(const std::string& group_key, const std::string& batch_id) {
     std::lock_guard<std::mutex> lock(mutex_);
     
@@ -236,19 +581,40 @@ bool GroupStorage::AcknowledgeBatch(const std::string& group_key, const std::str
     }
 
     // 세션 확인
-    auto it = group_sessions_.find(group_key);
+    auto it = FindGroupSession(group_key);
     if (it == group_sessions_.end()) {
         return false;
     }
     
     std::string session_id = it->second;
+
+    // 콜드 티어 사용 시 ACK 후 세그먼트 참조 해제를 위해 메타데이터 확인
+    std::string segment;
+    if (!options_.cold_tier_path.empty()) {
+        BatchMetadata metadata;
+        try {
+            if (batch_manager_->GetBatchMetadata(group_key, session_id, batch_id, metadata)) {
+                segment = metadata.GetSegment();
+            }
+        } catch (...) {
+            return false;
+        }
+    }
     
-    return batch_manager_->AcknowledgeBatch(group_key, session_id, batch_id);
+    size_t deleted_keys = 0;
+    if (!batch_manager_->AcknowledgeBatch(group_key, session_id, batch_id, &deleted_keys)) {
+        return false;
+    }
+
+    if (!segment.empty()) {
+        ReleaseSegment(group_key, segment);
+    }
+
+    RecordAcknowledgedKeys(group_key, session_id, batch_id, deleted_keys);
+    return true;
 }
 
-bool GroupStorage::ResaveBatch(const std::string& group_key,
-                               const std::string& batch_id,
-                               const std::vector<std::string>& remaining_data) {
+bool GroupStorage::AcknowledgeUpTo(const std::string& group_key, int64_t sequence_id) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (!storage_ || !batch_manager_) {
@@ -256,116 +622,1433 @@ bool GroupStorage::ResaveBatch(const std::string& group_key,
     }
 
     // 세션 확인
-    auto it = group_sessions_.find(group_key);
+    auto it = FindGroupSession(group_key);
     if (it == group_sessions_.end()) {
         return false;
     }
     
     std::string session_id = it->second;
 
-    // 원본 배치 메타데이터 조회
-    BatchMetadata original_metadata;
-    if (!batch_manager_->GetBatchMetadata(group_key, session_id, batch_id, original_metadata)) {
+    // 가져오기가 예약한 시퀀스 범위는 수집 전까지 비어 있으므로 워터마크를 올리지 않음
+    if (importing_groups_.count(group_key) > 0) {
         return false;
     }
 
-    // 원본 배치가 Loaded 상태인지 확인
-    if (original_metadata.GetStatus() != BatchStatus::LOADED) {
+    // 아직 할당되지 않은 시퀀스까지 ACK하면 이후 Save가 워터마크 아래에 기록되므로 거부
+    auto counter_it = group_sequence_counters_.find(group_key);
+    if (counter_it == group_sequence_counters_.end() || sequence_id > counter_it->second) {
         return false;
     }
 
-    // 남은 데이터가 없으면 원본 배치만 ACK
-    if (remaining_data.empty()) {
-        return batch_manager_->AcknowledgeBatch(group_key, session_id, batch_id);
+    std::string session_prefix = group_key + ":" + session_id + ":";
+    std::string watermark_key = session_prefix + kAckWatermarkSuffix;
+    int64_t watermark = -1;
+    std::string watermark_value;
+    if (storage_->Get(watermark_key, watermark_value) && !ParseInt64(watermark_value, watermark)) {
+        return false;
+    }
+    if (sequence_id <= watermark) {
+        return true;  // 이미 ACK된 범위
     }
 
-    // 새 배치 생성
-    int64_t new_sequence_start = GetNextSequenceId(group_key);
-    int64_t new_sequence_end = new_sequence_start + remaining_data.size() - 1;
-    
-    std::string new_batch_id = batch_manager_->CreateBatch(group_key, session_id,
-                                                           new_sequence_start, new_sequence_end);
-    if (new_batch_id.empty()) {
+    // 배치 ID(ULID) 순서와 시퀀스 순서는 일치하지 않을 수 있으므로 (ResaveBatch, SetBatchSize 이후 배치)
+    // 메타데이터를 모두 읽어 배치마다 범위를 확인: 전체 삭제할 배치와 워터마크가 걸쳐 있는 배치를 분류
+    std::string metadata_prefix = session_prefix + kBatchMetadataInfix;
+    std::string metadata_end = metadata_prefix;
+    metadata_end.back() = ';';
+    auto metadata_cursor = storage_->NewCursor(metadata_prefix, metadata_end, false);
+    if (!metadata_cursor) {
         return false;
     }
 
-    // 배치 쓰기 시작
-    if (!storage_->BeginBatch()) {
+    struct AckTarget {
+        BatchMetadata metadata;
+        bool whole;  // true면 배치 전체 삭제, false면 워터마크 이하만 삭제
+    };
+    std::vector<AckTarget> targets;
+    size_t whole_prefix = 0;               // 키 순서상 앞에서부터 연속으로 전체 삭제되는 배치 수
+    std::string first_remaining_batch_id;  // 비어 있으면 남은 배치 없음
+    try {
+        for (metadata_cursor->Seek(metadata_prefix); metadata_cursor->Valid(); metadata_cursor->Next()) {
+            BatchMetadata metadata;
+            if (!MetadataScan::Decode(metadata_cursor->Value(), metadata)) {
+                metadata.fromJson(std::string(metadata_cursor->Value()));
+            }
+            if (metadata.GetSequenceStart() > sequence_id) {
+                if (first_remaining_batch_id.empty()) {
+                    first_remaining_batch_id = metadata.GetBatchId();
+                }
+                continue;
+            }
+
+            bool whole = metadata.GetSequenceEnd() <= sequence_id;
+            if (!whole && metadata.GetSegment().empty()) {
+                // 워터마크 위에 남는 레코드가 없으면 (열린 배치를 끝까지 ACK한 경우 등) 배치 전체 삭제
+                std::string batch_prefix = session_prefix + metadata.GetBatchId() + ":";
+                std::string remaining_start = batch_prefix;
+                KeyFormat::AppendSequence(remaining_start, sequence_id + 1);
+                std::string batch_end = session_prefix + metadata.GetBatchId() + ";";
+                auto remaining_cursor = storage_->NewCursor(remaining_start, batch_end, false);
+                if (!remaining_cursor) {
+                    return false;
+                }
+                remaining_cursor->Seek(remaining_start);
+                whole = !remaining_cursor->Valid();
+            }
+
+            if (whole && first_remaining_batch_id.empty()) {
+                ++whole_prefix;
+            } else if (!whole && first_remaining_batch_id.empty()) {
+                first_remaining_batch_id = metadata.GetBatchId();
+            }
+            targets.push_back({std::move(metadata), whole});
+        }
+    } catch (...) {
         return false;
     }
+    metadata_cursor.reset();
 
-    // 새 배치에 데이터 저장
-    std::vector<std::string> new_data_keys;
-    batch_manager_->GenerateDataKeys(group_key, session_id, new_batch_id,
-                                    new_sequence_start, new_sequence_end, new_data_keys);
-    
-    for (size_t i = 0; i < remaining_data.size() && i < new_data_keys.size(); ++i) {
-        storage_->PutToBatch(new_data_keys[i], remaining_data[i]);
+    if (!storage_->BeginBatch()) {
+        return false;
+    }
+
+    // 중복 제거 참조 해제 (콜드 티어 배치는 이동 시 이미 해제됨)
+    auto release_references = [this, &session_prefix](const BatchMetadata& metadata, const std::string& end_key) {
+        std::string batch_prefix = session_prefix + metadata.GetBatchId() + ":";
+        auto data_cursor = storage_->NewCursor(batch_prefix, end_key, false);
+        if (!data_cursor) {
+            return;
+        }
+        for (data_cursor->Seek(batch_prefix); data_cursor->Valid(); data_cursor->Next()) {
+            std::string value(data_cursor->Value());
+            uint32_t checksum = 0;
+            if (!metadata.HasChecksums() || Checksum::SplitRecordChecksum(value, checksum)) {
+                dedup_manager_->ReleaseToBatch(value);
+            }
+        }
+    };
+
+    // 앞쪽의 연속된 전체 삭제 배치: 데이터 [group:session:, group:session:<첫 남은 배치>)와 메타데이터를 각각 범위 삭제
+    // (배치 ID 문자는 모두 'a'보다 작으므로 남은 배치가 없으면 데이터 범위 끝은 group:session:a)
+    if (whole_prefix > 0) {
+        storage_->DeleteRangeFromBatch(session_prefix, first_remaining_batch_id.empty()
+                                                           ? session_prefix + "a"
+                                                           : session_prefix + first_remaining_batch_id);
+        storage_->DeleteRangeFromBatch(metadata_prefix, first_remaining_batch_id.empty()
+                                                            ? metadata_end
+                                                            : metadata_prefix + first_remaining_batch_id);
+    }
+
+    size_t deleted_keys = 0;
+    std::string last_whole_batch_id;
+    for (size_t i = 0; i < targets.size(); ++i) {
+        BatchMetadata& metadata = targets[i].metadata;
+        std::string batch_start_key = session_prefix + metadata.GetBatchId() + ":";
+        if (targets[i].whole) {
+            std::string batch_end = session_prefix + metadata.GetBatchId() + ";";
+            if (dedup_manager_->IsEnabled() && metadata.GetSegment().empty()) {
+                release_references(metadata, batch_end);
+            }
+            // 남은 배치 뒤에 놓인 배치는 개별 범위 삭제
+            if (i >= whole_prefix) {
+                storage_->DeleteRangeFromBatch(batch_start_key, batch_end);
+                storage_->DeleteFromBatch(batch_manager_->MakeBatchMetadataKey(group_key, session_id,
+                                                                               metadata.GetBatchId()));
+            }
+            deleted_keys += static_cast<size_t>(metadata.GetSequenceEnd() - metadata.GetSequenceStart() + 2);
+            last_whole_batch_id = metadata.GetBatchId();
+            continue;
+        }
+
+        // 걸쳐 있는 배치: 워터마크 이하 데이터만 범위 삭제하고 시작 시퀀스를 워터마크 다음으로 조정
+        std::string trim_end = batch_start_key;
+        KeyFormat::AppendSequence(trim_end, sequence_id + 1);
+        if (metadata.GetSegment().empty()) {
+            if (dedup_manager_->IsEnabled()) {
+                release_references(metadata, trim_end);
+            }
+            storage_->DeleteRangeFromBatch(batch_start_key, trim_end);
+        }
+        deleted_keys += static_cast<size_t>(sequence_id - metadata.GetSequenceStart() + 1);
+        metadata.SetSequenceStart(sequence_id + 1);
+        storage_->PutToBatch(batch_manager_->MakeBatchMetadataKey(group_key, session_id, metadata.GetBatchId()),
+                             metadata.toJson());
+    }
+
+    storage_->PutToBatch(watermark_key, std::to_string(sequence_id));
+
+    // 단일 커밋
+    bool committed = storage_->CommitBatch();
+    dedup_manager_->FinishBatch();
+    if (!committed) {
+        return false;
+    }
+
+    if (dedup_manager_->IsEnabled()) {
+        dedup_manager_->CollectGarbage();
+    }
+
+    // 다음 Save가 쓸 배치를 삭제했으면 새 배치를 만들도록 추적 항목 제거
+    const int64_t batch_size = static_cast<int64_t>(default_batch_size_);
+    auto batch_it = group_current_batch_ids_.find(
+        group_key + ":" + std::to_string(((counter_it->second + 1) / batch_size) * batch_size));
+    for (const auto& target : targets) {
+        if (!target.whole) {
+            continue;
+        }
+        if (batch_it != group_current_batch_ids_.end() && batch_it->second == target.metadata.GetBatchId()) {
+            group_current_batch_ids_.erase(batch_it);
+            batch_it = group_current_batch_ids_.end();
+        }
+        if (!target.metadata.GetSegment().empty()) {
+            ReleaseSegment(group_key, target.metadata.GetSegment());
+        }
+    }
+
+    if (!last_whole_batch_id.empty()) {
+        RecordAcknowledgedKeys(group_key, session_id, last_whole_batch_id, deleted_keys);
+    }
+    return true;
+}
+
+bool GroupStorage::ResaveBatch(const std::string& group_key,
+                               const std::string& batch_id,
+                               std::span<const std::string> remaining_data) {
+    std::vector<std::string_view> views(remaining_data.begin(), remaining_data.end());
+    return ResaveBatch(group_key, batch_id, std::span<const std::string_view>(views));
+}
+
+bool GroupStorage::ResaveBatch(const std::string& group_key,
+                               const std::string& batch_id,
+                               std::span<const std::string_view> remaining_data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!storage_ || !batch_manager_) {
+        return false;
+    }
+
+    // 세션 확인
+    auto it = FindGroupSession(group_key);
+    if (it == group_sessions_.end()) {
+        return false;
+    }
+    
+    std::string session_id = it->second;
+
+    // 원본 배치 메타데이터 조회
+    BatchMetadata original_metadata;
+    if (!batch_manager_->GetBatchMetadata(group_key, session_id, batch_id, original_metadata)) {
+        return false;
+    }
+
+    // 원본 배치가 Loaded 상태인지 확인
+    if (original_metadata.GetStatus() != BatchStatus::LOADED) {
+        return false;
+    }
+
+    // 남은 데이터가 없으면 원본 배치만 ACK
+    if (remaining_data.empty()) {
+        size_t deleted_keys = 0;
+        if (!batch_manager_->AcknowledgeBatch(group_key, session_id, batch_id, &deleted_keys)) {
+            return false;
+        }
+        if (!original_metadata.GetSegment().empty()) {
+            ReleaseSegment(group_key, original_metadata.GetSegment());
+        }
+        RecordAcknowledgedKeys(group_key, session_id, batch_id, deleted_keys);
+        return true;
+    }
+
+    // 새 배치 생성
+    // 새 배치의 시퀀스 범위 전체를 예약하여 이후 Save와 시퀀스가 겹치지 않도록 함
+    int64_t new_sequence_start = GetNextSequenceId(group_key);
+    int64_t new_sequence_end = new_sequence_start + remaining_data.size() - 1;
+    group_sequence_counters_[group_key] = new_sequence_end;
+    
+    std::string new_batch_id = batch_manager_->CreateBatch(group_key, session_id,
+                                                           new_sequence_start, new_sequence_end);
+    if (new_batch_id.empty()) {
+        return false;
+    }
+
+    // 배치 쓰기 시작
+    if (!storage_->BeginBatch()) {
+        return false;
+    }
+
+    // 새 배치에 데이터 저장
+    std::vector<std::string> new_data_keys;
+    batch_manager_->GenerateDataKeys(group_key, session_id, new_batch_id,
+                                    new_sequence_start, new_sequence_end, new_data_keys);
+    
+    for (size_t i = 0; i < remaining_data.size() && i < new_data_keys.size(); ++i) {
+        PutPayloadToBatch(new_data_keys[i], remaining_data[i]);
     }
 
     // 원본 배치 삭제 (이미 배치가 시작된 상태이므로 직접 삭제)
     std::string metadata_key = batch_manager_->MakeBatchMetadataKey(group_key, session_id, batch_id);
     storage_->DeleteFromBatch(metadata_key);
     
-    // 원본 배치의 모든 데이터 키 삭제
-    std::vector<std::string> old_data_keys;
+    // 원본 배치의 모든 데이터 키 삭제
+    std::vector<std::string> old_data_keys;
+    batch_manager_->GenerateDataKeys(group_key, session_id, batch_id,
+                                    original_metadata.GetSequenceStart(),
+                                    original_metadata.GetSequenceEnd(),
+                                    old_data_keys);
+    
+    for (const auto& data_key : old_data_keys) {
+        // 중복 제거된 페이로드는 참조 카운트 감소
+        if (dedup_manager_->IsEnabled()) {
+            std::string value;
+            uint32_t checksum = 0;
+            if (storage_->Get(data_key, value) &&
+                (!original_metadata.HasChecksums() || Checksum::SplitRecordChecksum(value, checksum))) {
+                dedup_manager_->ReleaseToBatch(value);
+            }
+        }
+        storage_->DeleteFromBatch(data_key);
+    }
+
+    // 배치 커밋
+    bool committed = storage_->CommitBatch();
+    dedup_manager_->FinishBatch();
+    if (!committed) {
+        return false;
+    }
+
+    // 참조 카운트가 0이 된 페이로드 정리
+    if (dedup_manager_->IsEnabled()) {
+        dedup_manager_->CollectGarbage();
+    }
+
+    if (!original_metadata.GetSegment().empty()) {
+        ReleaseSegment(group_key, original_metadata.GetSegment());
+    }
+
+    RecordAcknowledgedKeys(group_key, session_id, batch_id, old_data_keys.size() + 1);
+    return true;
+}
+
+std::vector<std::string> GroupStorage::ListGroups() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    std::vector<std::string> groups;
+    if (!storage_) {
+        return groups;
+    }
+
+    // 레지스트리 키는 그룹 키 사전순으로 정렬되어 있음
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    storage_->ScanPrefix(kGroupRegistryPrefix, keys, values);
+    groups.reserve(keys.size());
+    for (const auto& key : keys) {
+        groups.push_back(key.substr(kGroupRegistryPrefix.size()));
+    }
+    return groups;
+}
+
+bool GroupStorage::DropGroup(const std::string& group_key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!storage_) {
+        return false;
+    }
+
+    if (IsReservedGroupKey(group_key) || !storage_->Exists(kGroupRegistryPrefix + group_key)) {
+        return false;
+    }
+
+    // 가져오는 중인 그룹을 삭제하면 수집된 키가 레지스트리 없이 남으므로 거부
+    if (importing_groups_.count(group_key) > 0) {
+        return false;
+    }
+
+    // 배치 쓰기 시작
+    if (!storage_->BeginBatch()) {
+        return false;
+    }
+
+    // 그룹의 모든 키는 "group_key:" 로 시작하므로 [group_key:, group_key;) 범위로 삭제
+    // (':' 다음 문자가 ';' 이므로 접두사 범위의 종료점이 됨)
+    // "group_key:xxx" 형태의 하위 그룹이 등록되어 있으면 해당 범위는 제외 (레지스트리 접두사 스캔)
+    std::string group_prefix = group_key + ":";
+    std::vector<std::pair<std::string, std::string>> excluded_ranges;
+    {
+        std::vector<std::string> child_keys;
+        std::vector<std::string> child_values;
+        storage_->ScanPrefix(kGroupRegistryPrefix + group_prefix, child_keys, child_values);
+        for (const auto& child_key : child_keys) {
+            std::string child = child_key.substr(kGroupRegistryPrefix.size());
+            excluded_ranges.push_back({child + ":", child + ";"});
+        }
+    }
+    std::sort(excluded_ranges.begin(), excluded_ranges.end());
+
+    std::vector<std::pair<std::string, std::string>> delete_ranges;
+    std::string range_start = group_prefix;
+    for (const auto& [excluded_start, excluded_end] : excluded_ranges) {
+        if (excluded_end <= range_start) {
+            continue;  // 이미 제외된 상위 범위에 포함됨
+        }
+        if (excluded_start > range_start) {
+            delete_ranges.push_back({range_start, excluded_start});
+        }
+        range_start = std::max(range_start, excluded_end);
+    }
+    delete_ranges.push_back({range_start, group_key + ";"});
+
+    // 중복 제거된 페이로드는 같은 커밋에서 참조 카운트 감소 (데이터 값을 순회하므로 데이터 양에 비례)
+    if (dedup_manager_->IsEnabled()) {
+        ReleaseGroupReferences(group_prefix, delete_ranges);
+    }
+
+    for (const auto& [delete_start, delete_end] : delete_ranges) {
+        storage_->DeleteRangeFromBatch(delete_start, delete_end);
+    }
+    storage_->DeleteFromBatch(kGroupRegistryPrefix + group_key);
+
+    // 프로듀서 high-water mark (시스템 키 공간에 있으므로 그룹 범위 삭제와 별도로 삭제)
+    std::string producer_prefix = MakeProducerKey(group_key, "");
+    storage_->DeleteRangeFromBatch(producer_prefix, producer_prefix.substr(0, producer_prefix.size() - 1) + ";");
+
+    // 그룹이 참조하던 콜드 티어 세그먼트 ("<segment_ref_prefix><group_key>:<ULID>.sst" 형식만 해당)
+    std::vector<std::string> segments;
+    if (!options_.cold_tier_path.empty()) {
+        std::string ref_prefix = MakeSegmentRefKey(group_key, "");
+        std::vector<std::string> ref_keys;
+        std::vector<std::string> ref_values;
+        storage_->ScanPrefix(ref_prefix, ref_keys, ref_values);
+        for (const auto& ref_key : ref_keys) {
+            std::string segment = ref_key.substr(ref_prefix.size());
+            if (segment.size() != ULID::ULID_LENGTH + kSegmentExtension.size() ||
+                segment.find(':') != std::string::npos) {
+                continue;  // 하위 그룹("group_key:xxx")의 참조
+            }
+            storage_->DeleteFromBatch(ref_key);
+            segments.push_back(std::move(segment));
+        }
+    }
+
+    // 배치 커밋
+    bool committed = storage_->CommitBatch();
+    dedup_manager_->FinishBatch();
+    if (!committed) {
+        return false;
+    }
+
+    if (dedup_manager_->IsEnabled()) {
+        dedup_manager_->CollectGarbage();
+    }
+
+    for (const auto& segment : segments) {
+        std::error_code ec;
+        std::filesystem::remove(MakeSegmentPath(segment), ec);
+    }
+
+    DiscardEvictedGroup(group_key);
+    ForgetGroup(group_key);
+    return true;
+}
+
+void GroupStorage::ReleaseGroupReferences(const std::string& group_prefix,
+                                          const std::vector<std::pair<std::string, std::string>>& ranges) {
+    // 데이터 키: "group:<session_id>:<batch_id>:<seq 20자리>" (체크섬 여부는 배치 메타데이터로 판단)
+    const size_t data_key_size = group_prefix.size() + ULID::ULID_LENGTH + 1 + ULID::ULID_LENGTH + 1 + kSequenceDigits;
+    const size_t batch_offset = group_prefix.size() + ULID::ULID_LENGTH + 1;
+
+    for (const auto& [range_start, range_end] : ranges) {
+        auto cursor = storage_->NewCursor(range_start, range_end, false);
+        if (!cursor) {
+            continue;
+        }
+
+        std::string current_batch;
+        bool has_metadata = false;
+        bool checksums = false;
+        for (cursor->Seek(range_start); cursor->Valid(); cursor->Next()) {
+            std::string_view key = cursor->Key();
+            if (key.size() != data_key_size || key[batch_offset - 1] != ':' ||
+                key[batch_offset + ULID::ULID_LENGTH] != ':') {
+                continue;
+            }
+
+            std::string_view batch_id = key.substr(batch_offset, ULID::ULID_LENGTH);
+            if (batch_id != current_batch) {
+                current_batch.assign(batch_id.data(), batch_id.size());
+                std::string metadata_key(key.substr(0, batch_offset));
+                metadata_key += kBatchMetadataInfix;
+                metadata_key += current_batch;
+                std::string metadata_json;
+                has_metadata = storage_->Get(metadata_key, metadata_json);
+                if (has_metadata) {
+                    BatchMetadata metadata;
+                    if (!MetadataScan::Decode(metadata_json, metadata)) {
+                        try {
+                            metadata.fromJson(metadata_json);
+                        } catch (...) {
+                            has_metadata = false;
+                        }
+                    }
+                    checksums = metadata.HasChecksums();
+                }
+            }
+            if (!has_metadata) {
+                continue;  // ACK 진행 중 남은 데이터
+            }
+
+            std::string value(cursor->Value());
+            uint32_t checksum = 0;
+            if (!checksums || Checksum::SplitRecordChecksum(value, checksum)) {
+                dedup_manager_->ReleaseToBatch(value);
+            }
+        }
+    }
+}
+
+size_t GroupStorage::EvictIdleGroups(int64_t idle_ms) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    
+    return EvictIdleGroupsLocked(lock, idle_ms);
+}
+
+size_t GroupStorage::GetResidentGroupCount() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    return group_sessions_.size();
+}
+
+bool GroupStorage::CompactAckedHead(const std::string& group_key) {
+    StorageUse storage_use;
+    std::vector<std::pair<std::string, std::string>> ranges;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        if (!storage_use.BeginLocked(this)) {
+            return false;
+        }
+
+        auto it = head_compaction_states_.find(group_key);
+        if (it == head_compaction_states_.end() || it->second.last_acked_batch_id.empty()) {
+            return false;
+        }
+
+        ranges = MakeHeadCompactionRanges(group_key, it->second);
+        it->second.deleted_keys = 0;
+    }
+
+    // 컴팩션은 오래 걸리므로 그룹 잠금 없이 실행 (Shutdown은 완료를 대기)
+    bool success = true;
+    for (const auto& range : ranges) {
+        success = storage_->CompactRange(range.first, range.second) && success;
+    }
+    return success;
+}
+
+size_t GroupStorage::SpillColdBatches(const std::string& group_key) {
+    if (options_.cold_tier_path.empty()) {
+        return 0;
+    }
+
+    StorageUse storage_use;
+    std::string session_id;
+    std::vector<std::string> batch_ids;
+    std::unordered_set<std::string> checksummed_batches;
+    std::unique_ptr<ICursor> cursor;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!storage_use.BeginLocked(this)) {
+            return 0;
+        }
+
+        auto it = FindGroupSession(group_key);
+        if (it == group_sessions_.end()) {
+            return 0;
+        }
+        session_id = it->second;
+
+        // 마지막으로 할당된 시퀀스 이하에서 끝나는 배치만 닫힌 배치 (현재 배치는 Save가 계속 추가함)
+        auto counter_it = group_sequence_counters_.find(group_key);
+        if (counter_it == group_sequence_counters_.end()) {
+            return 0;
+        }
+        int64_t last_sequence = counter_it->second;
+        int64_t cutoff = static_cast<int64_t>(ULID::Now()) - options_.cold_tier_min_age_ms;
+
+        std::vector<std::string> keys;
+        std::vector<std::string> values;
+        storage_->ScanPrefix(group_key + ":" + session_id + ":" + kBatchMetadataInfix, keys, values);
+        for (const auto& value : values) {
+            BatchMetadata metadata;
+            try {
+                metadata.fromJson(value);
+            } catch (...) {
+                continue;
+            }
+            if (metadata.GetStatus() == BatchStatus::PENDING && metadata.GetSegment().empty() &&
+                metadata.GetCreatedAt() <= cutoff && metadata.GetSequenceEnd() <= last_sequence) {
+                batch_ids.push_back(metadata.GetBatchId());
+                if (metadata.HasChecksums()) {
+                    checksummed_batches.insert(metadata.GetBatchId());
+                }
+            }
+        }
+        if (batch_ids.empty()) {
+            return 0;
+        }
+
+        // 세그먼트 키는 오름차순으로 추가해야 하므로 배치 ID(데이터 키 순서)로 정렬
+        std::sort(batch_ids.begin(), batch_ids.end());
+        cursor = NewDataCursor(group_key, session_id, false);
+        if (!cursor) {
+            return 0;
+        }
+    }
+
+    // 세그먼트 작성 (스냅샷 커서로 읽으므로 그룹 잠금 없이 수행)
+    std::error_code ec;
+    std::filesystem::create_directories(options_.cold_tier_path, ec);
+    std::string segment = ULID::GenerateMonotonic() + kSegmentExtension;
+    std::string segment_path = MakeSegmentPath(segment);
+
+    auto writer = storage_->NewExternalFileWriter(options_.cold_tier_compression);
+    if (!writer || !writer->Open(segment_path)) {
+        return 0;
+    }
+
+    size_t records = 0;
+    for (const auto& batch_id : batch_ids) {
+        std::string batch_prefix = group_key + ":" + session_id + ":" + batch_id + ":";
+        bool checksums = checksummed_batches.count(batch_id) > 0;
+        for (cursor->Seek(batch_prefix); cursor->Valid(); cursor->Next()) {
+            std::string_view key = cursor->Key();
+            if (key.compare(0, batch_prefix.size(), batch_prefix) != 0) {
+                break;
+            }
+
+            std::string value(cursor->Value());
+            if (!ResolveStoredValue(value, checksums)) {
+                continue;
+            }
+            if (!writer->Put(std::string(key), value)) {
+                std::filesystem::remove(segment_path, ec);
+                return 0;
+            }
+            records++;
+        }
+    }
+    cursor.reset();
+
+    if (records == 0 || !writer->Finish()) {
+        std::filesystem::remove(segment_path, ec);
+        return 0;
+    }
+
+    // 메타데이터 갱신 + 주 저장소 데이터 범위 삭제를 한 번에 커밋
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = FindGroupSession(group_key);
+    if (it == group_sessions_.end() || it->second != session_id || !storage_->BeginBatch()) {
+        std::filesystem::remove(segment_path, ec);
+        return 0;
+    }
+
+    size_t spilled = 0;
+    for (const auto& batch_id : batch_ids) {
+        // 세그먼트 작성 중 Load/ACK된 배치는 제외
+        BatchMetadata metadata;
+        try {
+            if (!batch_manager_->GetBatchMetadata(group_key, session_id, batch_id, metadata)) {
+                continue;
+            }
+        } catch (...) {
+            continue;
+        }
+        if (metadata.GetStatus() != BatchStatus::PENDING || !metadata.GetSegment().empty()) {
+            continue;
+        }
+
+        std::string batch_prefix = group_key + ":" + session_id + ":" + batch_id + ":";
+        std::string batch_end = batch_prefix;
+        batch_end.back() = ';';
+
+        // 중복 제거된 페이로드는 세그먼트에 본문이 있으므로 참조 카운트 감소
+        if (dedup_manager_->IsEnabled()) {
+            std::vector<std::string> keys;
+            std::vector<std::string> values;
+            storage_->ScanPrefix(batch_prefix, keys, values);
+            for (auto& value : values) {
+                uint32_t checksum = 0;
+                if (!metadata.HasChecksums() || Checksum::SplitRecordChecksum(value, checksum)) {
+                    dedup_manager_->ReleaseToBatch(value);
+                }
+            }
+        }
+
+        metadata.SetSegment(segment);
+        storage_->PutToBatch(batch_manager_->MakeBatchMetadataKey(group_key, session_id, batch_id),
+                             metadata.toJson());
+        storage_->DeleteRangeFromBatch(batch_prefix, batch_end);
+        spilled++;
+    }
+
+    if (spilled > 0) {
+        storage_->MergeCounterToBatch(MakeSegmentRefKey(group_key, segment), static_cast<int64_t>(spilled));
+    }
+
+    bool committed = storage_->CommitBatch();
+    dedup_manager_->FinishBatch();
+    if (!committed || spilled == 0) {
+        std::filesystem::remove(segment_path, ec);
+        return 0;
+    }
+
+    if (dedup_manager_->IsEnabled()) {
+        dedup_manager_->CollectGarbage();
+    }
+
+    // 범위 삭제된 데이터를 백그라운드에서 회수해 LSM 크기 축소
+    std::string range_start = group_key + ":" + session_id + ":" + batch_ids.front() + ":";
+    std::string range_end = group_key + ":" + session_id + ":" + batch_ids.back() + ";";
+    ScheduleCompaction({{range_start, range_end}});
+
+    return spilled;
+}
+
+bool GroupStorage::SnapshotGroup(const std::string& group_key, const std::string& path) {
+    // 읽는 동안 ACK/가비지 컬렉션/세그먼트 삭제/Shutdown이 끼어들지 않도록 끝까지 잠금 유지
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!storage_) {
+        return false;
+    }
+
+    auto it = FindGroupSession(group_key);
+    if (it == group_sessions_.end()) {
+        return false;
+    }
+    const std::string& session_id = it->second;
+
+    // 메타데이터 키는 배치 ID 순으로 정렬되어 있으므로 데이터 키 순서와 같음
+    std::vector<BatchMetadata> batches;
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    storage_->ScanPrefix(group_key + ":" + session_id + ":" + kBatchMetadataInfix, keys, values);
+    for (const auto& value : values) {
+        BatchMetadata metadata;
+        try {
+            metadata.fromJson(value);
+        } catch (...) {
+            continue;
+        }
+        batches.push_back(std::move(metadata));
+    }
+
+    auto cursor = NewDataCursor(group_key, session_id, false);
+    if (!cursor) {
+        return false;
+    }
+
+    ReplaySegmentWriter writer;
+    if (!writer.Open(path)) {
+        return false;
+    }
+
+    bool written = true;
+    try {
+        for (const auto& metadata : batches) {
+            ForEachBatchRecord(*cursor, group_key, session_id, metadata,
+                               [&writer, &written](std::string_view key, std::string& value) {
+                                   written = writer.Put(key, std::string_view(value));
+                                   return written;
+                               });
+            if (!written) {
+                return false;
+            }
+        }
+    } catch (const CorruptedBatchException&) {
+        return false;  // 손상되었거나 세그먼트가 없는 배치가 있으면 불완전한 스냅샷을 만들지 않음
+    }
+
+    return writer.Finish();
+}
+
+bool GroupStorage::ExportGroup(const std::string& group_key, const std::string& path) {
+    StorageUse storage_use;
+    std::string session_id;
+    std::unique_ptr<ICursor> cursor;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        if (!storage_use.BeginLocked(this)) {
+            return false;
+        }
+
+        auto it = FindGroupSession(group_key);
+        if (it == group_sessions_.end()) {
+            return false;
+        }
+
+        // 커서 생성 시점의 스냅샷으로 읽으므로 이후 잠금 불필요
+        session_id = it->second;
+        std::string session_prefix = group_key + ":" + session_id + ":";
+        std::string session_end = session_prefix;
+        session_end.back() = ';';
+        cursor = storage_->NewCursor(session_prefix, session_end, false);
+    }
+
+    auto writer = storage_->NewExternalFileWriter();
+    if (!cursor || !writer || !writer->Open(path)) {
+        return false;
+    }
+
+    // 배치 메타데이터를 먼저 읽어 콜드 티어로 이동된 배치를 확인 (내보낸 메타데이터에서는 세그먼트 표시 제거)
+    std::string session_prefix = group_key + ":" + session_id + ":";
+    std::string watermark_key = session_prefix + kAckWatermarkSuffix;
+    std::string metadata_prefix = session_prefix + kBatchMetadataInfix;
+    std::vector<BatchMetadata> spilled;
+    std::vector<std::pair<std::string, std::string>> metadata_entries;
+    for (cursor->Seek(metadata_prefix); cursor->Valid(); cursor->Next()) {
+        std::string_view key = cursor->Key();
+        if (key.compare(0, metadata_prefix.size(), metadata_prefix) != 0) {
+            break;
+        }
+
+        std::string value(cursor->Value());
+        BatchMetadata metadata;
+        try {
+            metadata.fromJson(value);
+        } catch (...) {
+            continue;
+        }
+        if (!metadata.GetSegment().empty()) {
+            spilled.push_back(metadata);
+            metadata.SetSegment("");
+            value = metadata.toJson();
+        }
+        metadata_entries.emplace_back(std::string(key), std::move(value));
+    }
+
+    // 이동된 배치의 레코드는 세그먼트에서 읽어 배치 ID 순서 위치에 같은 데이터 키로 기록
+    // (세그먼트 값은 변환된 페이로드이므로 체크섬 배치는 레코드 체크섬을 다시 붙임)
+    size_t count = 0;
+    size_t next_spilled = 0;
+    auto write_spilled_before = [&](std::string_view batch_id) {
+        while (next_spilled < spilled.size() &&
+               (batch_id.empty() || spilled[next_spilled].GetBatchId() < batch_id)) {
+            const BatchMetadata& metadata = spilled[next_spilled++];
+            bool written = true;
+            ForEachBatchRecord(*cursor, group_key, session_id, metadata,
+                               [&](std::string_view key, std::string& value) {
+                                   if (metadata.HasChecksums()) {
+                                       Checksum::AppendRecordChecksum(value, value);
+                                   }
+                                   written = writer->Put(std::string(key), value);
+                                   count++;
+                                   return written;
+                               });
+            if (!written) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // 키 순서(데이터 키 → 배치 메타데이터 키)대로 기록, 세션 상태/ACK 워터마크 키는 제외
+    try {
+        for (cursor->Seek(session_prefix); cursor->Valid(); cursor->Next()) {
+            std::string key(cursor->Key());
+            if (key.compare(0, metadata_prefix.size(), metadata_prefix) == 0) {
+                break;
+            }
+            if (key == watermark_key || key.size() != session_prefix.size() + ULID::ULID_LENGTH + 1 + kSequenceDigits) {
+                continue;
+            }
+
+            if (!write_spilled_before(std::string_view(key).substr(session_prefix.size(), ULID::ULID_LENGTH))) {
+                return false;
+            }
+
+            // 현재 세션의 배치는 모두 이 인스턴스가 같은 체크섬 설정으로 생성함
+            std::string value(cursor->Value());
+            if (!ResolveStoredValue(value, options_.enable_checksums)) {
+                continue;
+            }
+            if (!writer->Put(key, value)) {
+                return false;
+            }
+            count++;
+        }
+        if (!write_spilled_before(std::string_view())) {
+            return false;
+        }
+    } catch (const CorruptedBatchException&) {
+        return false;  // 세그먼트가 없거나 손상되면 일부 배치가 빠진 파일을 만들지 않음
+    }
+
+    for (const auto& [key, value] : metadata_entries) {
+        if (!writer->Put(key, value)) {
+            return false;
+        }
+        count++;
+    }
+
+    return count > 0 && writer->Finish();
+}
+
+bool GroupStorage::ImportGroup(const std::string& path, const std::string& group_key) {
+    // 파일 재작성과 수집은 그룹 잠금 없이 수행하므로 Shutdown이 끝날 때까지 대기하도록 등록
+    StorageUse storage_use;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!storage_use.BeginLocked(this)) {
+            return false;
+        }
+    }
+
+    auto reader = storage_->OpenExternalFile(path);
+    if (!reader) {
+        return false;
+    }
+
+    // 원본 "group:session:" 접두사 확인
+    reader->Seek("");
+    std::string source_prefix;
+    if (!reader->Valid() || !ParseSessionPrefix(reader->Key(), source_prefix)) {
+        return false;
+    }
+    std::string source_group = source_prefix.substr(0, source_prefix.size() - ULID::ULID_LENGTH - 2);
+    std::string target_group = group_key.empty() ? source_group : group_key;
+
+    // 원본 배치 → 새 배치 매핑
+    struct ImportedBatch {
+        std::string new_batch_id;
+        int64_t source_start;
+        int64_t target_start;
+        std::string metadata_json;
+        bool source_checksums;
+    };
+    std::unordered_map<std::string, ImportedBatch> batch_map;
+    std::vector<std::string> metadata_order;  // 새 배치 ID 순서 (= 원본 배치 ID 순서)
+    std::string target_session;
+
+    // 시퀀스 범위 예약부터 수집까지 그룹을 가져오는 중으로 표시하고, 재작성 파일은 항상 삭제
+    struct ImportCleanup {
+        GroupStorage* owner;
+        std::string group_key;
+        std::string rewritten_path;
+        bool importing = false;
+
+        ~ImportCleanup() {
+            if (!rewritten_path.empty()) {
+                std::error_code ec;
+                std::filesystem::remove(rewritten_path, ec);
+            }
+            if (importing) {
+                std::lock_guard<std::mutex> lock(owner->mutex_);
+                auto it = owner->importing_groups_.find(group_key);
+                if (it != owner->importing_groups_.end() && --it->second == 0) {
+                    owner->importing_groups_.erase(it);
+                }
+            }
+        }
+    };
+    ImportCleanup cleanup{this, target_group, path + ".import"};
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        if (IsReservedGroupKey(target_group)) {
+            return false;
+        }
+
+        target_session = GetOrCreateSession(target_group);
+        if (target_session.empty()) {
+            return false;
+        }
+
+        // 새 시퀀스 범위는 다음 배치 경계부터 배치 크기 단위로 정렬하여 할당
+        // (이후 Save가 만드는 배치와 시퀀스 범위가 겹치지 않도록 함)
+        const int64_t batch_size = static_cast<int64_t>(default_batch_size_);
+        int64_t next_sequence = 0;
+        auto counter_it = group_sequence_counters_.find(target_group);
+        if (counter_it != group_sequence_counters_.end()) {
+            next_sequence = counter_it->second + 1;
+        }
+        next_sequence = ((next_sequence + batch_size - 1) / batch_size) * batch_size;
+
+        std::string metadata_prefix = source_prefix + kBatchMetadataInfix;
+        for (reader->Seek(metadata_prefix); reader->Valid(); reader->Next()) {
+            std::string_view key = reader->Key();
+            if (key.compare(0, metadata_prefix.size(), metadata_prefix) != 0) {
+                break;
+            }
+
+            BatchMetadata metadata;
+            try {
+                metadata.fromJson(std::string(reader->Value()));
+            } catch (...) {
+                return false;
+            }
+
+            int64_t length = metadata.GetSequenceEnd() - metadata.GetSequenceStart() + 1;
+            if (length <= 0) {
+                continue;
+            }
+
+            ImportedBatch imported;
+            imported.new_batch_id = ULID::GenerateMonotonic();
+            imported.source_start = metadata.GetSequenceStart();
+            imported.target_start = next_sequence;
+
+            metadata.SetBatchId(imported.new_batch_id);
+            metadata.SetSequenceStart(next_sequence);
+            metadata.SetSequenceEnd(next_sequence + length - 1);
+            metadata.SetStatus(BatchStatus::PENDING);
+            metadata.SetLoadedAt(0);
+            metadata.SetSegment("");
+            imported.source_checksums = metadata.HasChecksums();
+            metadata.SetChecksums(options_.enable_checksums);
+            imported.metadata_json = metadata.toJson();
+
+            next_sequence += ((length + batch_size - 1) / batch_size) * batch_size;
+
+            std::string source_batch_id(key.substr(metadata_prefix.size()));
+            metadata_order.push_back(source_batch_id);
+            batch_map.emplace(std::move(source_batch_id), std::move(imported));
+        }
+
+        if (batch_map.empty()) {
+            return false;
+        }
+
+        // 할당한 시퀀스 범위 예약 (다음 Save는 새 배치 경계에서 시작)
+        group_sequence_counters_[target_group] = next_sequence - 1;
+        importing_groups_[target_group]++;
+        cleanup.importing = true;
+    }
+
+    // 새 세션/배치 ID/시퀀스로 키를 재작성한 파일 생성 (그룹 잠금 없이 순차 처리)
+    const std::string& rewritten_path = cleanup.rewritten_path;
+    auto writer = storage_->NewExternalFileWriter();
+    if (!writer || !writer->Open(rewritten_path)) {
+        return false;
+    }
+
+    size_t count = 0;
+    const ImportedBatch* current = nullptr;
+    std::string current_source_batch;
+    for (reader->Seek(source_prefix); reader->Valid(); reader->Next()) {
+        std::string_view key = reader->Key();
+        if (key.compare(0, source_prefix.size(), source_prefix) != 0 ||
+            key.compare(source_prefix.size(), kBatchMetadataInfix.size(), kBatchMetadataInfix) == 0) {
+            break;  // 데이터 키 구간 종료
+        }
+        if (key.size() != source_prefix.size() + ULID::ULID_LENGTH + 1 + kSequenceDigits) {
+            continue;
+        }
+
+        std::string_view source_batch = key.substr(source_prefix.size(), ULID::ULID_LENGTH);
+        if (!current || source_batch != current_source_batch) {
+            auto it = batch_map.find(std::string(source_batch));
+            current = it == batch_map.end() ? nullptr : &it->second;
+            current_source_batch.assign(source_batch.data(), source_batch.size());
+        }
+        if (!current) {
+            continue;  // 메타데이터가 없는 데이터 (ACK 진행 중 내보낸 경우)
+        }
+
+        int64_t source_sequence = 0;
+        if (!KeyFormat::ParseKeySequence(key, source_sequence)) {
+            continue;
+        }
+        int64_t target_sequence = current->target_start + (source_sequence - current->source_start);
+
+        std::string target_key = batch_manager_->MakeDataKey(target_group, target_session,
+                                                             current->new_batch_id, target_sequence);
+        // 레코드 체크섬은 대상 저장소 설정에 맞춤
+        std::string value(reader->Value());
+        if (current->source_checksums && !options_.enable_checksums) {
+            uint32_t checksum = 0;
+            if (!Checksum::SplitRecordChecksum(value, checksum)) {
+                return false;
+            }
+        } else if (!current->source_checksums && options_.enable_checksums) {
+            Checksum::AppendRecordChecksum(value, value);
+        }
+        // 내보낸 값은 원본 페이로드이므로 대상 저장소의 중복 제거 설정에 맞춰 이스케이프
+        size_t payload_size = value.size() - (options_.enable_checksums ? Checksum::RECORD_CHECKSUM_SIZE : 0);
+        if (dedup_manager_->NeedsEscape(std::string_view(value).substr(0, payload_size))) {
+            value.insert(value.begin(), '\0');
+        }
+        if (!writer->Put(target_key, value)) {
+            return false;
+        }
+        count++;
+    }
+
+    for (const auto& source_batch_id : metadata_order) {
+        const ImportedBatch& imported = batch_map.at(source_batch_id);
+        std::string target_key = batch_manager_->MakeBatchMetadataKey(target_group, target_session,
+                                                                      imported.new_batch_id);
+        if (!writer->Put(target_key, imported.metadata_json)) {
+            return false;
+        }
+        count++;
+    }
+
+    reader.reset();
+    if (count == 0 || !writer->Finish()) {
+        return false;
+    }
+
+    // 재작성 중 세션이 종료/재생성되었으면 이전 세션 키로 수집하지 않음
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session_it = FindGroupSession(target_group);
+    if (session_it == group_sessions_.end() || session_it->second != target_session) {
+        return false;
+    }
+    return storage_->IngestExternalFiles({rewritten_path}, true);
+}
+
+std::string GroupStorage::GetSessionId(const std::string& group_key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    auto it = FindGroupSession(group_key);
+    if (it != group_sessions_.end()) {
+        return it->second;
+    }
+    
+    return "";
+}
+
+void GroupStorage::SetBatchSize(size_t batch_size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    default_batch_size_ = batch_size;
+}
+
+
+int64_t GroupStorage::GetNextSequenceId(const std::string& group_key) {
+    auto it = group_sequence_counters_.find(group_key);
+    if (it == group_sequence_counters_.end()) {
+        group_sequence_counters_[group_key] = 0;
+        return 0;
+    }
+    
+    int64_t next = it->second + 1;
+    it->second = next;
+    return next;
+}
+
+std::string GroupStorage::GetOrCreateSession(const std::string& group_key) {
+    auto it = FindGroupSession(group_key);
+    if (it != group_sessions_.end()) {
+        return it->second;
+    }
+    
+    // 세션 초기화 (이미 mutex 잠금 상태이므로 잠금 없는 버전 호출)
+    if (InitializeSessionLocked(group_key)) {
+        return group_sessions_[group_key];
+    }
+    
+    return "";
+}
+
+std::unordered_map<std::string, std::string>::iterator GroupStorage::FindGroupSession(const std::string& group_key) {
+    auto it = group_sessions_.find(group_key);
+    if (it == group_sessions_.end()) {
+        // 축출된 그룹이면 저장된 상태에서 복원
+        if (!has_evicted_groups_ || !RestoreEvictedGroup(group_key)) {
+            return group_sessions_.end();
+        }
+        it = group_sessions_.find(group_key);
+    }
+
+    group_last_access_ms_[group_key] = SteadyNowMs();
+    return it;
+}
+
+bool GroupStorage::RestoreEvictedGroup(const std::string& group_key) {
+    std::string idle_key = kIdleGroupPrefix + group_key;
+    std::string value;
+    if (!storage_ || !storage_->Get(idle_key, value)) {
+        return false;
+    }
+
+    // <session_id>:<last_sequence>:<batch_start>:<batch_id>
+    std::string_view view(value);
+    size_t first = view.find(':');
+    size_t second = first == std::string_view::npos ? first : view.find(':', first + 1);
+    size_t third = second == std::string_view::npos ? second : view.find(':', second + 1);
+    int64_t last_sequence = -1;
+    int64_t batch_start = 0;
+    if (third == std::string_view::npos ||
+        !ParseInt64(view.substr(first + 1, second - first - 1), last_sequence) ||
+        !ParseInt64(view.substr(second + 1, third - second - 1), batch_start)) {
+        return false;
+    }
+
+    // 기록은 지우지 않음 (메모리에 있는 동안은 조회되지 않고, 다시 축출되면 덮어씀)
+    group_sessions_[group_key] = value.substr(0, first);
+    if (last_sequence >= 0) {
+        group_sequence_counters_[group_key] = last_sequence;
+    }
+    std::string_view batch_id = view.substr(third + 1);
+    if (!batch_id.empty()) {
+        group_current_batch_ids_[group_key + ":" + std::to_string(batch_start)] = std::string(batch_id);
+    }
+    return true;
+}
+
+void GroupStorage::DiscardEvictedGroup(const std::string& group_key) {
+    // 세션이 끝난 그룹이 이전 상태로 복원되지 않도록 기록 제거
+    if (has_evicted_groups_ && storage_) {
+        storage_->Delete(kIdleGroupPrefix + group_key);
+    }
+}
+
+std::string GroupStorage::AllocateDataKey(const std::string& group_key,
+                                          const std::string& session_id,
+                                          std::vector<std::string>* created_batch_keys) {
+    // 다음 시퀀스 ID 획득
+    int64_t sequence_id = GetNextSequenceId(group_key);
+    
+    // 현재 배치의 시퀀스 범위 계산
+    int64_t batch_start = (sequence_id / default_batch_size_) * default_batch_size_;
+    int64_t batch_end = batch_start + default_batch_size_ - 1;
+    
+    // 배치 키 생성 (그룹별 현재 배치 추적용)
+    std::string batch_key = group_key + ":" + std::to_string(batch_start);
+    
+    // 배치가 새로 시작되는 경우 배치 생성
+    std::string batch_id;
+    auto batch_it = group_current_batch_ids_.find(batch_key);
+    if (batch_it == group_current_batch_ids_.end()) {
+        if (created_batch_keys) {
+            // 진행 중인 배치 쓰기에 메타데이터 추가 (커밋은 호출자 담당)
+            batch_id = batch_manager_->CreateBatchInWriteBatch(group_key, session_id,
+                                                               batch_start, batch_end);
+            created_batch_keys->push_back(batch_key);
+        } else {
+            batch_id = batch_manager_->CreateBatch(group_key, session_id, 
+                                                  batch_start, batch_end);
+        }
+        if (batch_id.empty()) {
+            return "";
+        }
+        group_current_batch_ids_[batch_key] = batch_id;
+        // 시퀀스는 증가만 하므로 직전 배치 범위의 추적 키는 더 이상 조회되지 않음
+        if (batch_start >= static_cast<int64_t>(default_batch_size_)) {
+            group_current_batch_ids_.erase(group_key + ":" +
+                                           std::to_string(batch_start - static_cast<int64_t>(default_batch_size_)));
+        }
+    } else {
+        batch_id = batch_it->second;
+    }
+
+    // 데이터 키 생성
+    std::vector<std::string> data_keys;
     batch_manager_->GenerateDataKeys(group_key, session_id, batch_id,
-                                    original_metadata.GetSequenceStart(),
-                                    original_metadata.GetSequenceEnd(),
-                                    old_data_keys);
+                                     sequence_id, sequence_id, data_keys);
     
-    for (const auto& data_key : old_data_keys) {
-        storage_->DeleteFromBatch(data_key);
+    if (data_keys.empty()) {
+        return "";
     }
 
-    // 배치 커밋
-    return storage_->CommitBatch();
+    return data_keys[0];
 }
 
-std::string GroupStorage::GetSessionId(const std::string& group_key) {
+void GroupStorage::DiscardBatchKeys(const std::vector<std::string>& batch_keys) {
+    // 커밋되지 않은 배치 메타데이터를 가리키는 추적 항목 제거
+    for (const auto& batch_key : batch_keys) {
+        group_current_batch_ids_.erase(batch_key);
+    }
+}
+
+bool GroupStorage::PutPayload(const std::string& data_key, std::string_view data) {
+    if (!dedup_manager_->ShouldDeduplicate(data.size())) {
+        bool escape = dedup_manager_->NeedsEscape(data);
+        if (!options_.enable_checksums && !escape) {
+            return storage_->Put(data_key, data);
+        }
+        std::string stored = MakeRawStoredValue(data, escape);
+        return storage_->Put(data_key, stored);
+    }
+
+    // 페이로드 본문/참조 카운트와 데이터 키를 원자적으로 저장
+    if (!storage_->BeginBatch()) {
+        return false;
+    }
+
+    std::string stored = dedup_manager_->EncodeToBatch(data);
+    if (options_.enable_checksums) {
+        Checksum::AppendRecordChecksum(stored, data);
+    }
+    storage_->PutToBatch(data_key, stored);
+    bool committed = storage_->CommitBatch();
+    dedup_manager_->FinishBatch();
+    return committed;
+}
+
+void GroupStorage::PutPayloadToBatch(const std::string& data_key, std::string_view data) {
+    if (!dedup_manager_->ShouldDeduplicate(data.size())) {
+        bool escape = dedup_manager_->NeedsEscape(data);
+        if (!options_.enable_checksums && !escape) {
+            storage_->PutToBatch(data_key, data);
+            return;
+        }
+        storage_->PutToBatch(data_key, MakeRawStoredValue(data, escape));
+        return;
+    }
+
+    std::string stored = dedup_manager_->EncodeToBatch(data);
+    if (options_.enable_checksums) {
+        Checksum::AppendRecordChecksum(stored, data);
+    }
+    storage_->PutToBatch(data_key, stored);
+}
+
+std::string GroupStorage::MakeRawStoredValue(std::string_view data, bool escape) const {
+    std::string stored;
+    stored.reserve(data.size() + 1 + Checksum::RECORD_CHECKSUM_SIZE);
+    if (escape) {
+        stored.push_back('\0');
+    }
+    stored.append(data.data(), data.size());
+    if (options_.enable_checksums) {
+        Checksum::AppendRecordChecksum(stored, data);
+    }
+    return stored;
+}
+
+StorageStats GroupStorage::GetStorageStats() {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    auto it = group_sessions_.find(group_key);
-    if (it != group_sessions_.end()) {
-        return it->second;
+    StorageStats stats;
+    if (storage_) {
+        storage_->GetStats(stats);
     }
-    
-    return "";
+    return stats;
 }
 
-void GroupStorage::SetBatchSize(size_t batch_size) {
+bool GroupStorage::Flush() {
     std::lock_guard<std::mutex> lock(mutex_);
-    default_batch_size_ = batch_size;
+    
+    return storage_ && storage_->Flush();
 }
 
+bool GroupStorage::CreateCheckpoint(const std::string& checkpoint_dir) {
+    // 그룹 잠금 없이 실행하여 체크포인트 중에도 Save가 진행되도록 함 (Shutdown은 완료를 대기)
+    // (SaveMulti 등 단일 WriteBatch 커밋은 원자적으로 포함되거나 제외됨)
+    StorageUse storage_use;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!storage_use.BeginLocked(this)) {
+            return false;
+        }
+    }
+    return storage_->CreateCheckpoint(checkpoint_dir);
+}
 
-int64_t GroupStorage::GetNextSequenceId(const std::string& group_key) {
-    auto it = group_sequence_counters_.find(group_key);
-    if (it == group_sequence_counters_.end()) {
-        group_sequence_counters_[group_key] = 0;
-        return 0;
+bool GroupStorage::CreateBackup(const std::string& backup_dir, BackupInfo* info) {
+    StorageUse storage_use;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!storage_use.BeginLocked(this)) {
+            return false;
+        }
     }
-    
-    int64_t next = it->second + 1;
-    it->second = next;
-    return next;
+    return storage_->CreateBackup(backup_dir, info);
 }
 
-std::string GroupStorage::GetOrCreateSession(const std::string& group_key) {
-    auto it = group_sessions_.find(group_key);
-    if (it != group_sessions_.end()) {
+DedupStats GroupStorage::GetDedupStats() const {
+    return dedup_manager_->GetStats();
+}
+
+std::string GroupStorage::MakeProducerKey(const std::string& group_key,
+                                          const std::string& producer_id) {
+    return kProducerPrefix + std::to_string(group_key.size()) + ":" + group_key + ":" + producer_id;
+}
+
+int64_t GroupStorage::GetProducerHighWaterMark(const std::string& producer_key) {
+    auto it = producer_high_water_marks_.find(producer_key);
+    if (it != producer_high_water_marks_.end()) {
         return it->second;
     }
-    
-    // 세션 초기화
-    if (InitializeSession(group_key)) {
-        return group_sessions_[group_key];
+
+    // 캐시에 없으면 영속된 값 조회 (없으면 최소값)
+    std::string value;
+    if (!storage_->Get(producer_key, value)) {
+        return std::numeric_limits<int64_t>::min();
     }
-    
-    return "";
+
+    int64_t high_water_mark = std::numeric_limits<int64_t>::min();
+    try {
+        high_water_mark = std::stoll(value);
+    } catch (...) {
+        return std::numeric_limits<int64_t>::min();
+    }
+
+    if (producer_high_water_marks_.size() >= kMaxCachedProducers) {
+        producer_high_water_marks_.erase(producer_high_water_marks_.begin());
+    }
+    producer_high_water_marks_[producer_key] = high_water_mark;
+    return high_water_mark;
+}
+
+bool GroupStorage::RegisterGroup(const std::string& group_key) {
+    if (IsReservedGroupKey(group_key)) {
+        return false;  // 예약된 그룹 키
+    }
+
+    // 이미 등록된 그룹은 등록 시각을 덮어쓰지 않음 (그룹 목록은 메모리에 두지 않고 저장소에서 조회)
+    std::string registry_key = kGroupRegistryPrefix + group_key;
+    if (storage_->Exists(registry_key)) {
+        return true;
+    }
+
+    // 값에는 등록 시각 기록 (조회에는 키만 사용)
+    return storage_->Put(registry_key, std::to_string(ULID::Now()));
 }
 
-bool GroupStorage::LoadBatchData(const std::string& group_key,
+void GroupStorage::ForgetGroup(const std::string& group_key) {
+    group_sessions_.erase(group_key);
+    group_sequence_counters_.erase(group_key);
+    head_compaction_states_.erase(group_key);
+    group_last_access_ms_.erase(group_key);
+
+    // 현재 배치 추적 키는 "group_key:batch_start" 형식
+    std::string batch_key_prefix = group_key + ":";
+    auto is_own_batch_key = [&batch_key_prefix](const std::string& batch_key) {
+        if (batch_key.size() <= batch_key_prefix.size() ||
+            batch_key.compare(0, batch_key_prefix.size(), batch_key_prefix) != 0) {
+            return false;
+        }
+        return std::all_of(batch_key.begin() + batch_key_prefix.size(), batch_key.end(),
+                           [](char c) { return c >= '0' && c <= '9'; });
+    };
+    for (auto it = group_current_batch_ids_.begin(); it != group_current_batch_ids_.end();) {
+        if (is_own_batch_key(it->first)) {
+            it = group_current_batch_ids_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // 프로듀서 high-water mark 캐시 (키는 MakeProducerKey 형식)
+    std::string producer_key_prefix = MakeProducerKey(group_key, "");
+    for (auto it = producer_high_water_marks_.begin(); it != producer_high_water_marks_.end();) {
+        if (it->first.compare(0, producer_key_prefix.size(), producer_key_prefix) == 0) {
+            it = producer_high_water_marks_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool GroupStorage::LoadBatchData(ICursor& cursor,
+                                const std::string& group_key,
                                 const std::string& session_id,
                                 const std::string& batch_id,
                                 BatchLoadResult& result) {
@@ -379,24 +2062,520 @@ bool GroupStorage::LoadBatchData(const std::string& group_key,
     result.sequence_start = metadata.GetSequenceStart();
     result.sequence_end = metadata.GetSequenceEnd();
 
-    // 배치의 모든 데이터 키 생성
-    std::vector<std::string> data_keys;
-    batch_manager_->GenerateDataKeys(group_key, session_id, batch_id,
-                                    metadata.GetSequenceStart(),
-                                    metadata.GetSequenceEnd(),
-                                    data_keys);
-
     // 데이터 로드
     result.data.clear();
-    for (const auto& key : data_keys) {
-        std::string value;
-        if (storage_->Get(key, value)) {
-            result.data.push_back(value);
+    ReadBatchPayloads(cursor, group_key, session_id, metadata, result.data);
+
+    return true;
+}
+
+std::unique_ptr<ICursor> GroupStorage::NewDataCursor(const std::string& group_key,
+                                                     const std::string& session_id,
+                                                     bool tailing) {
+    // 데이터 키는 "group:session:<batch_id>:<seq>" 형식이며 배치 ID(ULID) 문자는 모두 'a'보다 작으므로
+    // [group:session:, group:session:a) 범위는 메타데이터/상태 키("batch:", "state")를 제외한 데이터 키만 포함
+    std::string data_prefix = group_key + ":" + session_id + ":";
+    return storage_->NewCursor(data_prefix, data_prefix + "a", tailing);
+}
+
+void GroupStorage::ReadBatchesParallel(const std::string& group_key,
+                                       const std::string& session_id,
+                                       const std::vector<std::pair<int64_t, BatchMetadata>>& batches,
+                                       size_t num_threads,
+                                       std::vector<std::string>& data) {
+    // 작업자별 커서 (호출 스레드에서 생성, 각 커서는 한 작업자만 사용)
+    std::vector<std::unique_ptr<ICursor>> cursors;
+    for (size_t i = 0; i < num_threads; ++i) {
+        auto cursor = NewDataCursor(group_key, session_id, false);
+        if (!cursor) {
+            break;
+        }
+        cursors.push_back(std::move(cursor));
+    }
+    if (cursors.empty()) {
+        return;
+    }
+
+    // 재정렬 버퍼: 배치 i는 슬롯 i % window에 놓이며, 작업자는 아직 내보내지 않은 가장 앞 배치보다
+    // window개 이상 앞서 읽지 않음 (메모리에 머무는 배치 수 제한)
+    struct ReorderState {
+        std::mutex mutex;
+        std::condition_variable produced;
+        std::condition_variable consumed;
+        std::vector<std::vector<std::string>> slots;
+        std::vector<bool> ready;
+        size_t next_batch = 0;
+        size_t next_emit = 0;
+        size_t active_workers = 0;
+        bool aborted = false;
+        std::exception_ptr error;
+    };
+    const size_t window = cursors.size() * 2;
+    ReorderState state;
+    state.slots.resize(window);
+    state.ready.assign(window, false);
+    state.active_workers = cursors.size();
+
+    for (auto& cursor : cursors) {
+        ICursor* worker_cursor = cursor.get();
+        RunLoadTask([this, &state, &batches, &group_key, &session_id, window, worker_cursor] {
+            while (true) {
+                size_t index = 0;
+                {
+                    std::unique_lock<std::mutex> lock(state.mutex);
+                    state.consumed.wait(lock, [&] {
+                        return state.aborted || state.next_batch >= batches.size() ||
+                               state.next_batch < state.next_emit + window;
+                    });
+                    if (state.aborted || state.next_batch >= batches.size()) {
+                        break;
+                    }
+                    index = state.next_batch++;
+                }
+
+                std::vector<std::string> payloads;
+                try {
+                    ReadBatchPayloads(*worker_cursor, group_key, session_id, batches[index].second, payloads);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    if (!state.error) {
+                        state.error = std::current_exception();
+                    }
+                    state.aborted = true;
+                    state.produced.notify_all();
+                    state.consumed.notify_all();
+                    break;
+                }
+
+                std::lock_guard<std::mutex> lock(state.mutex);
+                state.slots[index % window] = std::move(payloads);
+                state.ready[index % window] = true;
+                state.produced.notify_all();
+            }
+
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.active_workers--;
+            state.produced.notify_all();
+        }, cursors.size());
+    }
+
+    // 호출 스레드가 배치 순서대로 조립
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        for (size_t index = 0; index < batches.size(); ++index) {
+            size_t slot = index % window;
+            state.produced.wait(lock, [&] { return state.aborted || state.ready[slot]; });
+            if (state.aborted) {
+                break;
+            }
+            std::vector<std::string> payloads = std::move(state.slots[slot]);
+            state.slots[slot].clear();
+            state.ready[slot] = false;
+            state.next_emit++;
+            state.consumed.notify_all();
+
+            lock.unlock();
+            data.insert(data.end(), std::make_move_iterator(payloads.begin()),
+                        std::make_move_iterator(payloads.end()));
+            lock.lock();
+        }
+
+        // 작업자가 모두 끝난 뒤 반환 (상태와 커서는 이 함수의 지역 변수)
+        state.aborted = true;
+        state.consumed.notify_all();
+        state.produced.wait(lock, [&] { return state.active_workers == 0; });
+    }
+
+    if (state.error) {
+        std::rethrow_exception(state.error);
+    }
+}
+
+void GroupStorage::RunLoadTask(std::function<void()> task, size_t num_threads) {
+    {
+        std::lock_guard<std::mutex> lock(load_mutex_);
+        load_running_ = true;
+        while (load_threads_.size() < num_threads) {
+            load_threads_.emplace_back(&GroupStorage::LoadWorker, this);
+        }
+        load_tasks_.push_back(std::move(task));
+    }
+    load_cv_.notify_one();
+}
+
+void GroupStorage::StopLoadThreads() {
+    {
+        std::lock_guard<std::mutex> lock(load_mutex_);
+        if (!load_running_) {
+            return;
+        }
+        load_running_ = false;
+    }
+    load_cv_.notify_all();
+
+    for (auto& thread : load_threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    load_threads_.clear();
+}
+
+void GroupStorage::LoadWorker() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(load_mutex_);
+            load_cv_.wait(lock, [this] {
+                return !load_running_ || !load_tasks_.empty();
+            });
+
+            if (!load_running_) {
+                break;
+            }
+
+            task = std::move(load_tasks_.front());
+            load_tasks_.pop_front();
+        }
+
+        task();
+    }
+}
+
+size_t GroupStorage::ReadBatchPayloads(ICursor& cursor,
+                                       const std::string& group_key,
+                                       const std::string& session_id,
+                                       const BatchMetadata& metadata,
+                                       std::vector<std::string>& data) {
+    // 체크섬은 배치 단위로 모아 일괄 검증
+    size_t first = data.size();
+    std::vector<uint32_t> checksums;
+    size_t count = ForEachBatchRecord(cursor, group_key, session_id, metadata,
+                                      [&data](std::string_view, std::string& value) {
+                                          data.push_back(std::move(value));
+                                          return true;
+                                      },
+                                      metadata.HasChecksums() ? &checksums : nullptr);
+
+    if (!checksums.empty() &&
+        Checksum::VerifyBatch(data.data() + first, checksums.data(), checksums.size()) != checksums.size()) {
+        throw CorruptedBatchException(metadata.GetBatchId());
+    }
+    return count;
+}
+
+size_t GroupStorage::ForEachBatchRecord(ICursor& cursor,
+                                        const std::string& group_key,
+                                        const std::string& session_id,
+                                        const BatchMetadata& metadata,
+                                        const std::function<bool(std::string_view, std::string&)>& visit,
+                                        std::vector<uint32_t>* deferred_checksums) {
+    // 배치의 데이터 키는 "group:session:batch_id:" 접두사 아래에 시퀀스 순으로 연속 저장됨
+    // 키별 Get 대신 범위 순회로 읽어 블록 단위 readahead/비동기 I/O가 적용되도록 함
+    std::string batch_prefix = group_key + ":" + session_id + ":" + metadata.GetBatchId() + ":";
+
+    // 콜드 티어로 이동된 배치는 같은 키로 세그먼트 파일에 저장됨 (페이로드는 이미 변환된 상태)
+    // 세그먼트 파일이 없거나 열 수 없으면 데이터가 유실된 것이므로 손상으로 처리 (LoadBatch는 Pending으로 남김)
+    std::unique_ptr<ICursor> segment_cursor;
+    if (!metadata.GetSegment().empty()) {
+        segment_cursor = storage_->OpenExternalFile(MakeSegmentPath(metadata.GetSegment()));
+        if (!segment_cursor) {
+            throw CorruptedBatchException(metadata.GetBatchId());
+        }
+    }
+    ICursor& source = segment_cursor ? *segment_cursor : cursor;
+    
+    // 값 버퍼는 레코드 간 재사용 (방문자가 이동해 가지 않으면 용량이 유지됨)
+    std::string value;
+    size_t count = 0;
+    for (source.Seek(batch_prefix); source.Valid(); source.Next()) {
+        std::string_view key = source.Key();
+        if (key.compare(0, batch_prefix.size(), batch_prefix) != 0) {
+            break;
+        }
+
+        // 부분 누적 ACK된 배치의 세그먼트에는 시작 시퀀스 이전 레코드가 남아 있음
+        int64_t sequence_id = 0;
+        if (segment_cursor && KeyFormat::ParseKeySequence(key, sequence_id) &&
+            sequence_id < metadata.GetSequenceStart()) {
+            continue;
+        }
+
+        value.assign(source.Value());
+        uint32_t expected = 0;
+        if (metadata.HasChecksums() && !Checksum::SplitRecordChecksum(value, expected)) {
+            throw CorruptedBatchException(metadata.GetBatchId());
+        }
+        // 해시 참조이면 실제 페이로드로 변환
+        if (!segment_cursor && !dedup_manager_->Resolve(value)) {
+            continue;
+        }
+        if (metadata.HasChecksums()) {
+            if (deferred_checksums) {
+                deferred_checksums->push_back(expected);
+            } else if (Checksum::Crc32c(value) != expected) {
+                throw CorruptedBatchException(metadata.GetBatchId());
+            }
+        }
+        if (!visit(key, value)) {
+            break;
         }
+        count++;
+    }
+
+    return count;
+}
+
+bool GroupStorage::ResolveStoredValue(std::string& value, bool checksums) {
+    if (!checksums) {
+        return dedup_manager_->Resolve(value);
+    }
+    if (value.size() < Checksum::RECORD_CHECKSUM_SIZE) {
+        return false;
     }
 
+    // 레코드 체크섬은 원래 페이로드 기준이므로 참조만 바꾸고 그대로 유지
+    std::string trailer = value.substr(value.size() - Checksum::RECORD_CHECKSUM_SIZE);
+    value.resize(value.size() - Checksum::RECORD_CHECKSUM_SIZE);
+    if (!dedup_manager_->Resolve(value)) {
+        return false;
+    }
+    value += trailer;
     return true;
 }
 
+std::string GroupStorage::MakeSegmentPath(const std::string& segment) {
+    return (std::filesystem::path(options_.cold_tier_path) / segment).string();
+}
+
+std::string GroupStorage::MakeSegmentRefKey(const std::string& group_key, const std::string& segment) {
+    return kSegmentRefPrefix + group_key + ":" + segment;
+}
+
+void GroupStorage::ReleaseSegment(const std::string& group_key, const std::string& segment) {
+    // 세그먼트의 마지막 배치가 ACK되면 참조 카운트 키와 파일 삭제
+    std::string ref_key = MakeSegmentRefKey(group_key, segment);
+    storage_->MergeCounter(ref_key, -1);
+
+    int64_t remaining = 0;
+    if (storage_->GetCounter(ref_key, remaining) && remaining > 0) {
+        return;
+    }
+
+    storage_->Delete(ref_key);
+    std::error_code ec;
+    std::filesystem::remove(MakeSegmentPath(segment), ec);
+}
+
+void GroupStorage::RecordAcknowledgedKeys(const std::string& group_key,
+                                          const std::string& session_id,
+                                          const std::string& batch_id,
+                                          size_t deleted_keys) {
+    HeadCompactionState& state = head_compaction_states_[group_key];
+    
+    // 세션이 바뀌면 이전 세션 키는 모두 새 세션 ID보다 앞에 있으므로 헤드 범위에 포함됨
+    if (state.session_id != session_id) {
+        state.session_id = session_id;
+        state.last_acked_batch_id.clear();
+    }
+    if (batch_id > state.last_acked_batch_id) {
+        state.last_acked_batch_id = batch_id;
+    }
+    state.deleted_keys += deleted_keys;
+
+    if (options_.head_compaction_threshold == 0 ||
+        state.deleted_keys < options_.head_compaction_threshold) {
+        return;
+    }
+
+    state.deleted_keys = 0;
+    ScheduleCompaction(MakeHeadCompactionRanges(group_key, state));
+}
+
+std::vector<std::pair<std::string, std::string>> GroupStorage::MakeHeadCompactionRanges(
+    const std::string& group_key, const HeadCompactionState& state) {
+    // 배치 ID(ULID)는 생성 순서대로 정렬되므로 ACK된 배치는 키 공간의 앞쪽(헤드)에 모임
+    // 1) 이전 세션 전체 + 현재 세션의 ACK된 데이터 키: [group:, group:session:last_batch;)
+    // 2) 현재 세션의 ACK된 배치 메타데이터: [group:session:batch:, group:session:batch:last_batch;)
+    //    ("batch"는 소문자라 ULID 문자보다 뒤에 정렬되어 데이터 키와 별도 범위가 됨)
+    std::string session_prefix = group_key + ":" + state.session_id + ":";
+    std::string metadata_prefix = session_prefix + "batch:";
+    return {
+        {group_key + ":", session_prefix + state.last_acked_batch_id + ";"},
+        {metadata_prefix, metadata_prefix + state.last_acked_batch_id + ";"},
+    };
+}
+
+void GroupStorage::ScheduleCompaction(std::vector<std::pair<std::string, std::string>> ranges) {
+    std::lock_guard<std::mutex> lock(compaction_mutex_);
+    
+    for (auto& range : ranges) {
+        compaction_queue_.push_back(std::move(range));
+    }
+
+    if (!compaction_running_) {
+        compaction_running_ = true;
+        compaction_thread_ = std::thread(&GroupStorage::CompactionWorker, this);
+    }
+    compaction_cv_.notify_one();
+}
+
+void GroupStorage::StopCompactionThread() {
+    {
+        std::lock_guard<std::mutex> lock(compaction_mutex_);
+        if (!compaction_running_) {
+            return;
+        }
+        compaction_running_ = false;
+        compaction_queue_.clear();
+    }
+    compaction_cv_.notify_one();
+
+    if (compaction_thread_.joinable()) {
+        compaction_thread_.join();
+    }
+}
+
+void GroupStorage::CompactionWorker() {
+    while (true) {
+        std::pair<std::string, std::string> range;
+        {
+            std::unique_lock<std::mutex> lock(compaction_mutex_);
+            compaction_cv_.wait(lock, [this] {
+                return !compaction_running_ || !compaction_queue_.empty();
+            });
+            
+            if (!compaction_running_) {
+                break;
+            }
+            
+            range = std::move(compaction_queue_.front());
+            compaction_queue_.pop_front();
+        }
+
+        storage_->CompactRange(range.first, range.second);
+    }
+}
+
+size_t GroupStorage::EvictIdleGroupsLocked(std::unique_lock<std::mutex>& lock, int64_t idle_ms) {
+    if (!storage_ || group_sessions_.empty()) {
+        return 0;
+    }
+
+    int64_t now = SteadyNowMs();
+    std::vector<std::string> candidates;
+    for (const auto& [group_key, session_id] : group_sessions_) {
+        auto access_it = group_last_access_ms_.find(group_key);
+        if (access_it == group_last_access_ms_.end() || now - access_it->second >= idle_ms) {
+            candidates.push_back(group_key);
+        }
+    }
+
+    // 커밋당 kIdleEvictionChunk개씩 기록하고 청크 사이에는 잠금을 풀어 다른 작업이 끼어들 수 있도록 함
+    const int64_t batch_size = static_cast<int64_t>(default_batch_size_);
+    size_t evicted = 0;
+    for (size_t offset = 0; offset < candidates.size(); offset += kIdleEvictionChunk) {
+        if (offset > 0) {
+            lock.unlock();
+            lock.lock();
+            if (shutting_down_ || !storage_) {
+                break;
+            }
+            now = SteadyNowMs();
+        }
+
+        // 잠금을 푼 사이 종료되었거나 다시 사용된 그룹은 제외
+        struct IdleEntry {
+            std::string group_key;
+            std::string batch_key;  // 현재 배치 추적 키 ("group_key:batch_start")
+            std::string state;
+        };
+        std::vector<IdleEntry> chunk;
+        size_t chunk_end = std::min(offset + kIdleEvictionChunk, candidates.size());
+        for (size_t i = offset; i < chunk_end; ++i) {
+            const std::string& group_key = candidates[i];
+            auto session_it = group_sessions_.find(group_key);
+            if (session_it == group_sessions_.end()) {
+                continue;
+            }
+            auto access_it = group_last_access_ms_.find(group_key);
+            if (access_it != group_last_access_ms_.end() && now - access_it->second < idle_ms) {
+                continue;
+            }
+
+            int64_t last_sequence = -1;
+            int64_t batch_start = 0;
+            std::string batch_id;
+            auto counter_it = group_sequence_counters_.find(group_key);
+            if (counter_it != group_sequence_counters_.end()) {
+                last_sequence = counter_it->second;
+                batch_start = (last_sequence / batch_size) * batch_size;
+            }
+            std::string batch_key = group_key + ":" + std::to_string(batch_start);
+            auto batch_it = group_current_batch_ids_.find(batch_key);
+            if (counter_it != group_sequence_counters_.end() && batch_it != group_current_batch_ids_.end()) {
+                batch_id = batch_it->second;
+            }
+            chunk.push_back({group_key, std::move(batch_key),
+                             session_it->second + ":" + std::to_string(last_sequence) + ":" +
+                                 std::to_string(batch_start) + ":" + batch_id});
+        }
+        if (chunk.empty()) {
+            continue;
+        }
+
+        // 복원에 필요한 상태를 청크당 한 번의 커밋으로 기록 (실패하면 메모리 상태 유지)
+        if (!storage_->BeginBatch()) {
+            break;
+        }
+        for (const auto& entry : chunk) {
+            storage_->PutToBatch(kIdleGroupPrefix + entry.group_key, entry.state);
+        }
+        if (!storage_->CommitBatch()) {
+            break;
+        }
+
+        // 지난 배치의 추적 키는 새 배치 생성 시 제거되므로 현재 배치 키만 정리
+        for (const auto& entry : chunk) {
+            group_sessions_.erase(entry.group_key);
+            group_sequence_counters_.erase(entry.group_key);
+            group_current_batch_ids_.erase(entry.batch_key);
+            head_compaction_states_.erase(entry.group_key);
+            group_last_access_ms_.erase(entry.group_key);
+        }
+        has_evicted_groups_ = true;
+        evicted += chunk.size();
+    }
+
+    return evicted;
+}
+
+void GroupStorage::StopIdleEvictionThread() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!idle_eviction_running_) {
+            return;
+        }
+        idle_eviction_running_ = false;
+    }
+    idle_eviction_cv_.notify_one();
+
+    if (idle_eviction_thread_.joinable()) {
+        idle_eviction_thread_.join();
+    }
+}
+
+void GroupStorage::IdleEvictionWorker() {
+    // 그룹 잠금을 잡고 실행하므로 진행 중인 작업 도중에는 축출되지 않음 (청크 사이에서만 잠금 해제)
+    const auto interval = std::chrono::milliseconds(std::max<int64_t>(options_.idle_group_timeout_ms / 2, 1));
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (idle_eviction_running_) {
+        if (idle_eviction_cv_.wait_for(lock, interval, [this] { return !idle_eviction_running_; })) {
+            break;
+        }
+        EvictIdleGroupsLocked(lock, options_.idle_group_timeout_ms);
+    }
+}
+
 } // namespace durastash
 
@@ -0,0 +1,119 @@
+#include "durastash/hash.h"
+#include <cstring>
+
+namespace durastash {
+
+namespace {
+
+constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t RotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// 리틀 엔디언 읽기 (x86/ARM 기준, 정렬되지 않은 주소 허용)
+inline uint64_t Read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t Round(uint64_t acc, uint64_t input) {
+    acc += input * PRIME64_2;
+    acc = RotateLeft(acc, 31);
+    acc *= PRIME64_1;
+    return acc;
+}
+
+inline uint64_t MergeRound(uint64_t acc, uint64_t value) {
+    value = Round(0, value);
+    acc ^= value;
+    acc = acc * PRIME64_1 + PRIME64_4;
+    return acc;
+}
+
+} // namespace
+
+uint64_t Hash::XXH64(const void* data, size_t length, uint64_t seed) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* end = p + length;
+    uint64_t h64;
+
+    if (length >= 32) {
+        // 32바이트 스트라이프 단위로 4개 누산기 병렬 처리
+        const uint8_t* limit = end - 32;
+        uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+        uint64_t v2 = seed + PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME64_1;
+
+        do {
+            v1 = Round(v1, Read64(p));
+            v2 = Round(v2, Read64(p + 8));
+            v3 = Round(v3, Read64(p + 16));
+            v4 = Round(v4, Read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h64 = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        h64 = MergeRound(h64, v1);
+        h64 = MergeRound(h64, v2);
+        h64 = MergeRound(h64, v3);
+        h64 = MergeRound(h64, v4);
+    } else {
+        h64 = seed + PRIME64_5;
+    }
+
+    h64 += static_cast<uint64_t>(length);
+
+    // 남은 바이트 처리
+    while (p + 8 <= end) {
+        h64 ^= Round(0, Read64(p));
+        h64 = RotateLeft(h64, 27) * PRIME64_1 + PRIME64_4;
+        p += 8;
+    }
+
+    if (p + 4 <= end) {
+        h64 ^= static_cast<uint64_t>(Read32(p)) * PRIME64_1;
+        h64 = RotateLeft(h64, 23) * PRIME64_2 + PRIME64_3;
+        p += 4;
+    }
+
+    while (p < end) {
+        h64 ^= static_cast<uint64_t>(*p) * PRIME64_5;
+        h64 = RotateLeft(h64, 11) * PRIME64_1;
+        ++p;
+    }
+
+    // 최종 혼합 (avalanche)
+    h64 ^= h64 >> 33;
+    h64 *= PRIME64_2;
+    h64 ^= h64 >> 29;
+    h64 *= PRIME64_3;
+    h64 ^= h64 >> 32;
+
+    return h64;
+}
+
+std::string Hash::ToHex(uint64_t value) {
+    static constexpr char HEX_CHARS[] = "0123456789abcdef";
+    
+    std::string hex(HEX64_LENGTH, '0');
+    for (int i = static_cast<int>(HEX64_LENGTH) - 1; i >= 0; --i) {
+        hex[i] = HEX_CHARS[value & 0xF];
+        value >>= 4;
+    }
+    return hex;
+}
+
+} // namespace durastash
@@ -0,0 +1,109 @@
+#include "durastash/key_format.h"
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace durastash {
+
+namespace {
+
+// "00" ~ "99" 두 자리 테이블 (컴파일 타임 생성)
+constexpr std::array<char, 200> MakeDigitPairs() {
+    std::array<char, 200> pairs{};
+    for (int i = 0; i < 100; ++i) {
+        pairs[i * 2] = static_cast<char>('0' + i / 10);
+        pairs[i * 2 + 1] = static_cast<char>('0' + i % 10);
+    }
+    return pairs;
+}
+
+constexpr auto kDigitPairs = MakeDigitPairs();
+
+constexpr uint64_t kTenPow8 = 100000000ULL;
+constexpr uint64_t kTenPow16 = kTenPow8 * kTenPow8;
+
+// 8자리 (0 ~ 99999999) 기록: 32비트 나눗셈 3회 + 테이블 복사 4회
+inline void Write8(char* out, uint32_t value) {
+    uint32_t high = value / 10000;
+    uint32_t low = value % 10000;
+    std::memcpy(out, &kDigitPairs[(high / 100) * 2], 2);
+    std::memcpy(out + 2, &kDigitPairs[(high % 100) * 2], 2);
+    std::memcpy(out + 4, &kDigitPairs[(low / 100) * 2], 2);
+    std::memcpy(out + 6, &kDigitPairs[(low % 100) * 2], 2);
+}
+
+// 8자리 파싱 (SWAR: 8바이트를 한 번에 검증하고 곱셈 3회로 변환)
+inline bool Parse8(const char* p, uint32_t& value) {
+    uint64_t chunk;
+    std::memcpy(&chunk, p, sizeof(chunk));
+    if constexpr (std::endian::native == std::endian::big) {
+        chunk = 0;
+        for (size_t i = 8; i-- > 0;) {
+            chunk = (chunk << 8) | static_cast<unsigned char>(p[i]);
+        }
+    }
+
+    // 모든 바이트가 '0'(0x30) ~ '9'(0x39)인지 검사
+    if ((chunk & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL ||
+        ((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL) {
+        return false;
+    }
+
+    // 첫 문자가 최하위 바이트 (리틀 엔디언 적재): 인접 자릿수를 2 → 4 → 8자리로 합침
+    chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+    chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    value = static_cast<uint32_t>(((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+    return true;
+}
+
+} // anonymous namespace
+
+void KeyFormat::FormatSequence(char* out, int64_t sequence_id) {
+    uint64_t value = static_cast<uint64_t>(sequence_id);
+    uint64_t head = value / kTenPow16;            // 상위 4자리 (최대 1844)
+    uint64_t rest = value % kTenPow16;
+
+    uint32_t head32 = static_cast<uint32_t>(head);
+    std::memcpy(out, &kDigitPairs[(head32 / 100) * 2], 2);
+    std::memcpy(out + 2, &kDigitPairs[(head32 % 100) * 2], 2);
+    Write8(out + 4, static_cast<uint32_t>(rest / kTenPow8));
+    Write8(out + 12, static_cast<uint32_t>(rest % kTenPow8));
+}
+
+bool KeyFormat::ParseSequence(std::string_view digits, int64_t& sequence_id) {
+    if (digits.size() != SEQUENCE_DIGITS) {
+        return false;
+    }
+
+    // 상위 4자리는 개별 검증, 나머지 16자리는 8자리씩 SWAR
+    uint32_t head = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        uint32_t digit = static_cast<uint32_t>(static_cast<unsigned char>(digits[i])) - '0';
+        if (digit > 9) {
+            return false;
+        }
+        head = head * 10 + digit;
+    }
+
+    uint32_t middle = 0;
+    uint32_t low = 0;
+    if (!Parse8(digits.data() + 4, middle) || !Parse8(digits.data() + 12, low)) {
+        return false;
+    }
+
+    // int64 최대값 9223372036854775807 초과 여부 (상위 4자리 ≤ 922이면 uint64 범위 안)
+    constexpr uint64_t kMax = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+    if (head > kMax / kTenPow16) {
+        return false;
+    }
+    uint64_t value = head * kTenPow16 + static_cast<uint64_t>(middle) * kTenPow8 + low;
+    if (value > kMax) {
+        return false;
+    }
+
+    sequence_id = static_cast<int64_t>(value);
+    return true;
+}
+
+} // namespace durastash
@@ -0,0 +1,31 @@
+#include "durastash/memory_budget.h"
+#include <rocksdb/cache.h>
+#include <rocksdb/write_buffer_manager.h>
+#include <algorithm>
+
+namespace durastash {
+
+std::shared_ptr<MemoryBudget> MemoryBudget::Create(size_t capacity, double write_buffer_ratio) {
+    double ratio = std::clamp(write_buffer_ratio, 0.0, 1.0);
+    size_t write_buffer_limit = static_cast<size_t>(static_cast<double>(capacity) * ratio);
+    return std::shared_ptr<MemoryBudget>(new MemoryBudget(capacity, write_buffer_limit));
+}
+
+MemoryBudget::MemoryBudget(size_t capacity, size_t write_buffer_limit)
+    : capacity_(capacity)
+    , write_buffer_limit_(write_buffer_limit) {
+    block_cache_ = rocksdb::NewLRUCache(capacity_);
+    // 메모리 테이블을 블록 캐시에 청구하고, 상한 초과 시 쓰기를 지연시켜 상한을 강제
+    write_buffer_manager_ = std::make_shared<rocksdb::WriteBufferManager>(
+        write_buffer_limit_, block_cache_, true);
+}
+
+size_t MemoryBudget::GetUsage() const {
+    return block_cache_->GetUsage();
+}
+
+size_t MemoryBudget::GetWriteBufferUsage() const {
+    return write_buffer_manager_->memory_usage();
+}
+
+} // namespace durastash
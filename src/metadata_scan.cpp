@@ -0,0 +1,246 @@
+#include "durastash/metadata_scan.h"
+#include <bit>
+#include <charconv>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define DURASTASH_SCAN_SSE2 1
+#if defined(__GNUC__) || defined(__clang__)
+#define DURASTASH_SCAN_AVX2 1
+#define DURASTASH_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(__AVX2__)
+#define DURASTASH_SCAN_AVX2 1
+#define DURASTASH_AVX2_TARGET
+#endif
+#endif
+
+namespace durastash {
+
+namespace {
+
+// 필드 이름 최대 길이 (패턴 버퍼 크기 제한)
+constexpr size_t kMaxFieldLength = 32;
+
+#if defined(DURASTASH_SCAN_SSE2)
+
+// needle 길이 2 이상에서 사용: 첫 바이트와 마지막 바이트가 모두 일치하는 위치만 memcmp로 확인
+size_t FindSse2(const char* s, size_t n, const char* p, size_t k, size_t i) {
+    const __m128i first = _mm_set1_epi8(p[0]);
+    const __m128i last = _mm_set1_epi8(p[k - 1]);
+    for (; i + k - 1 + 16 <= n; i += 16) {
+        __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + k - 1));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+        while (mask != 0) {
+            size_t bit = static_cast<size_t>(std::countr_zero(mask));
+            if (std::memcmp(s + i + bit + 1, p + 1, k - 2) == 0) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return i;  // 남은 구간은 호출자가 스칼라로 처리
+}
+
+#endif
+
+#if defined(DURASTASH_SCAN_AVX2)
+
+DURASTASH_AVX2_TARGET
+size_t FindAvx2(const char* s, size_t n, const char* p, size_t k, size_t i) {
+    const __m256i first = _mm256_set1_epi8(p[0]);
+    const __m256i last = _mm256_set1_epi8(p[k - 1]);
+    for (; i + k - 1 + 32 <= n; i += 32) {
+        __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + k - 1));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last))));
+        while (mask != 0) {
+            size_t bit = static_cast<size_t>(std::countr_zero(mask));
+            if (std::memcmp(s + i + bit + 1, p + 1, k - 2) == 0) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return i;
+}
+
+bool DetectAvx2() {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_cpu_supports("avx2");
+#else
+    return true;  // /arch:AVX2로 빌드한 경우에만 이 경로 사용
+#endif
+}
+
+const bool kAvx2Available = DetectAvx2();
+
+#endif
+
+/**
+ * "필드": 다음 위치 반환 (객체 최상위 키로 등장한 경우만, 없으면 npos)
+ */
+size_t FindValue(std::string_view json, std::string_view field) {
+    if (field.size() > kMaxFieldLength) {
+        return std::string_view::npos;
+    }
+
+    char pattern[kMaxFieldLength + 3];
+    pattern[0] = '"';
+    std::memcpy(pattern + 1, field.data(), field.size());
+    pattern[field.size() + 1] = '"';
+    pattern[field.size() + 2] = ':';
+    std::string_view needle(pattern, field.size() + 3);
+
+    size_t position = 0;
+    while ((position = MetadataScan::Find(json, needle, position)) != std::string_view::npos) {
+        // 문자열 값 안의 같은 바이트열은 따옴표가 이스케이프되므로 키 앞에는 항상 '{' 또는 ','
+        if (position > 0 && (json[position - 1] == '{' || json[position - 1] == ',')) {
+            return position + needle.size();
+        }
+        position++;
+    }
+    return std::string_view::npos;
+}
+
+bool ReadInt64(std::string_view json, size_t position, int64_t& value) {
+    const char* begin = json.data() + position;
+    const char* end = json.data() + json.size();
+    auto [next, error] = std::from_chars(begin, end, value);
+    // 실수/지수 표기 등은 전체 파싱에 맡김
+    return error == std::errc() && next != begin && next < end && (*next == ',' || *next == '}');
+}
+
+bool ReadString(std::string_view json, size_t position, std::string_view& value) {
+    if (position >= json.size() || json[position] != '"') {
+        return false;
+    }
+    size_t start = position + 1;
+    size_t end = json.find('"', start);
+    if (end == std::string_view::npos) {
+        return false;
+    }
+    value = json.substr(start, end - start);
+    // 이스케이프가 있으면 전체 파싱에 맡김
+    return value.find('\\') == std::string_view::npos;
+}
+
+bool ParseStatus(std::string_view text, BatchStatus& status) {
+    if (text == "pending") {
+        status = BatchStatus::PENDING;
+    } else if (text == "loaded") {
+        status = BatchStatus::LOADED;
+    } else if (text == "acknowledged") {
+        status = BatchStatus::ACKNOWLEDGED;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+size_t MetadataScan::Find(std::string_view haystack, std::string_view needle, size_t from) {
+    if (needle.size() < 2 || from >= haystack.size() || haystack.size() - from < needle.size()) {
+        return haystack.find(needle, from);
+    }
+
+    size_t position = from;
+#if defined(DURASTASH_SCAN_AVX2)
+    if (kAvx2Available) {
+        position = FindAvx2(haystack.data(), haystack.size(), needle.data(), needle.size(), position);
+        if (position + needle.size() <= haystack.size() &&
+            haystack.compare(position, needle.size(), needle) == 0) {
+            return position;
+        }
+    }
+#endif
+#if defined(DURASTASH_SCAN_SSE2)
+    position = FindSse2(haystack.data(), haystack.size(), needle.data(), needle.size(), position);
+    if (position + needle.size() <= haystack.size() &&
+        haystack.compare(position, needle.size(), needle) == 0) {
+        return position;
+    }
+#endif
+    return haystack.find(needle, position);
+}
+
+size_t MetadataScan::FindPortable(std::string_view haystack, std::string_view needle, size_t from) {
+    return haystack.find(needle, from);
+}
+
+const char* MetadataScan::VectorIsa() {
+#if defined(DURASTASH_SCAN_AVX2)
+    if (kAvx2Available) {
+        return "avx2";
+    }
+#endif
+#if defined(DURASTASH_SCAN_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+bool MetadataScan::ProbeStatus(std::string_view json, BatchStatus& status) {
+    size_t position = FindValue(json, "status");
+    std::string_view text;
+    return position != std::string_view::npos && ReadString(json, position, text) && ParseStatus(text, status);
+}
+
+bool MetadataScan::ProbeInt64(std::string_view json, std::string_view field, int64_t& value) {
+    size_t position = FindValue(json, field);
+    return position != std::string_view::npos && ReadInt64(json, position, value);
+}
+
+bool MetadataScan::Decode(std::string_view json, BatchMetadata& metadata) {
+    std::string_view batch_id;
+    std::string_view status_text;
+    BatchStatus status = BatchStatus::PENDING;
+    int64_t sequence_start = 0;
+    int64_t sequence_end = 0;
+    int64_t created_at = 0;
+
+    size_t batch_id_position = FindValue(json, "batch_id");
+    size_t status_position = FindValue(json, "status");
+    if (batch_id_position == std::string_view::npos || !ReadString(json, batch_id_position, batch_id) ||
+        status_position == std::string_view::npos || !ReadString(json, status_position, status_text) ||
+        !ParseStatus(status_text, status) ||
+        !ProbeInt64(json, "sequence_start", sequence_start) ||
+        !ProbeInt64(json, "sequence_end", sequence_end) ||
+        !ProbeInt64(json, "created_at", created_at)) {
+        return false;
+    }
+
+    // 선택 필드: 없으면 기본값, 있는데 형식이 다르면 실패
+    int64_t loaded_at = 0;
+    size_t position = FindValue(json, "loaded_at");
+    if (position != std::string_view::npos && !ReadInt64(json, position, loaded_at)) {
+        return false;
+    }
+    std::string_view segment;
+    position = FindValue(json, "segment");
+    if (position != std::string_view::npos && !ReadString(json, position, segment)) {
+        return false;
+    }
+    std::string_view checksum;
+    position = FindValue(json, "checksum");
+    if (position != std::string_view::npos && !ReadString(json, position, checksum)) {
+        return false;
+    }
+
+    metadata.SetBatchId(std::string(batch_id));
+    metadata.SetSequenceStart(sequence_start);
+    metadata.SetSequenceEnd(sequence_end);
+    metadata.SetStatus(status);
+    metadata.SetCreatedAt(created_at);
+    metadata.SetLoadedAt(loaded_at);
+    metadata.SetSegment(std::string(segment));
+    metadata.SetChecksums(checksum == "crc32c");
+    return true;
+}
+
+} // namespace durastash
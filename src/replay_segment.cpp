@@ -0,0 +1,293 @@
+#include "durastash/replay_segment.h"
+#include "durastash/hash.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace durastash {
+
+namespace {
+
+constexpr char kMagic[8] = {'D', 'S', 'R', 'E', 'P', 'L', 'A', 'Y'};
+constexpr uint32_t kVersion = 1;
+
+struct SegmentHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t record_count;
+    uint64_t index_offset;
+    uint64_t file_size;
+    uint64_t checksum;
+};
+static_assert(sizeof(SegmentHeader) == 48, "segment header must be 48 bytes");
+
+struct SegmentIndexEntry {
+    uint64_t offset;
+    uint32_t key_size;
+    uint32_t value_size;
+};
+static_assert(sizeof(SegmentIndexEntry) == 16, "segment index entry must be 16 bytes");
+
+/**
+ * 읽기 전용 파일 매핑 (POSIX mmap / Windows MapViewOfFile)
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+#else
+        if (data_) {
+            munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+    }
+
+    bool Open(const std::string& path) {
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_, &file_size) || file_size.QuadPart == 0) {
+            return false;
+        }
+        size_ = static_cast<size_t>(file_size.QuadPart);
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) {
+            return false;
+        }
+        data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        return data_ != nullptr;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // 매핑은 파일 디스크립터와 무관하게 유지됨
+        if (data == MAP_FAILED) {
+            return false;
+        }
+        data_ = static_cast<const char*>(data);
+        // 리플레이는 앞에서부터 순차로 읽으므로 커널 readahead 확대
+        posix_madvise(data, size_, POSIX_MADV_SEQUENTIAL);
+        return true;
+#endif
+    }
+
+    const char* Data() const {
+        return data_;
+    }
+
+    size_t Size() const {
+        return size_;
+    }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+};
+
+/**
+ * 매핑된 리플레이 세그먼트 커서 (불변 파일이므로 갱신 불필요)
+ */
+class ReplaySegmentCursor : public ICursor {
+public:
+    bool Open(const std::string& path, bool verify_checksum) {
+        if (!file_.Open(path) || file_.Size() < sizeof(SegmentHeader)) {
+            return false;
+        }
+
+        SegmentHeader header;
+        std::memcpy(&header, file_.Data(), sizeof(header));
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion ||
+            header.file_size != file_.Size() || header.index_offset % alignof(SegmentIndexEntry) != 0 ||
+            header.index_offset > file_.Size() ||
+            header.record_count > (file_.Size() - header.index_offset) / sizeof(SegmentIndexEntry)) {
+            return false;
+        }
+
+        // 오프셋 테이블은 8바이트 정렬 위치에 있으므로 매핑된 메모리를 그대로 배열로 사용
+        index_ = reinterpret_cast<const SegmentIndexEntry*>(file_.Data() + header.index_offset);
+        count_ = header.record_count;
+
+        uint64_t checksum = 0;
+        for (size_t i = 0; i < count_; ++i) {
+            const SegmentIndexEntry& entry = index_[i];
+            if (entry.offset < sizeof(SegmentHeader) ||
+                entry.offset + static_cast<uint64_t>(entry.key_size) + entry.value_size > header.index_offset) {
+                return false;
+            }
+            if (verify_checksum) {
+                checksum = Hash::XXH64(file_.Data() + entry.offset,
+                                       static_cast<size_t>(entry.key_size) + entry.value_size, checksum);
+            }
+        }
+        if (verify_checksum &&
+            Hash::XXH64(index_, count_ * sizeof(SegmentIndexEntry), checksum) != header.checksum) {
+            return false;
+        }
+
+        position_ = count_;
+        return true;
+    }
+
+    void Seek(const std::string& key) override {
+        // 키는 오름차순이므로 이진 탐색
+        const SegmentIndexEntry* found = std::lower_bound(
+            index_, index_ + count_, std::string_view(key),
+            [this](const SegmentIndexEntry& entry, std::string_view target) {
+                return KeyOf(entry) < target;
+            });
+        position_ = static_cast<size_t>(found - index_);
+    }
+
+    bool Valid() const override {
+        return position_ < count_;
+    }
+
+    void Next() override {
+        position_++;
+    }
+
+    std::string_view Key() const override {
+        return KeyOf(index_[position_]);
+    }
+
+    std::string_view Value() const override {
+        const SegmentIndexEntry& entry = index_[position_];
+        return std::string_view(file_.Data() + entry.offset + entry.key_size, entry.value_size);
+    }
+
+    bool Refresh() override {
+        return true;
+    }
+
+private:
+    MappedFile file_;
+    const SegmentIndexEntry* index_ = nullptr;
+    size_t count_ = 0;
+    size_t position_ = 0;
+
+    std::string_view KeyOf(const SegmentIndexEntry& entry) const {
+        return std::string_view(file_.Data() + entry.offset, entry.key_size);
+    }
+};
+
+} // anonymous namespace
+
+bool ReplaySegmentWriter::Open(const std::string& path) {
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+        return false;
+    }
+
+    // 헤더는 Finish에서 채움
+    SegmentHeader header{};
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    index_.clear();
+    last_key_.clear();
+    offset_ = sizeof(header);
+    checksum_ = 0;
+    return static_cast<bool>(file_);
+}
+
+bool ReplaySegmentWriter::Put(const std::string& key, const std::string& value) {
+    return Put(std::string_view(key), std::string_view(value));
+}
+
+bool ReplaySegmentWriter::Put(std::string_view key, std::string_view value) {
+    if (!file_.is_open() || key.size() > std::numeric_limits<uint32_t>::max() ||
+        value.size() > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    if (!index_.empty() && key <= last_key_) {
+        return false;
+    }
+
+    // 리더는 키+값 연속 구간을 한 번에 해시하므로 같은 구간으로 연쇄 해시
+    record_.assign(key.data(), key.size());
+    record_.append(value.data(), value.size());
+    file_.write(record_.data(), static_cast<std::streamsize>(record_.size()));
+    if (!file_) {
+        return false;
+    }
+    checksum_ = Hash::XXH64(record_, checksum_);
+
+    index_.push_back({offset_, static_cast<uint32_t>(key.size()), static_cast<uint32_t>(value.size())});
+    last_key_.assign(key.data(), key.size());
+    offset_ += key.size() + value.size();
+    return true;
+}
+
+bool ReplaySegmentWriter::Finish() {
+    if (!file_.is_open() || index_.empty()) {
+        return false;
+    }
+
+    // 오프셋 테이블은 8바이트 정렬
+    uint64_t padding = (alignof(IndexEntry) - offset_ % alignof(IndexEntry)) % alignof(IndexEntry);
+    static const char zeros[alignof(IndexEntry)] = {};
+    file_.write(zeros, static_cast<std::streamsize>(padding));
+    uint64_t index_offset = offset_ + padding;
+    file_.write(reinterpret_cast<const char*>(index_.data()),
+                static_cast<std::streamsize>(index_.size() * sizeof(IndexEntry)));
+
+    SegmentHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.record_count = index_.size();
+    header.index_offset = index_offset;
+    header.file_size = index_offset + index_.size() * sizeof(IndexEntry);
+    header.checksum = Hash::XXH64(index_.data(), index_.size() * sizeof(IndexEntry), checksum_);
+
+    file_.seekp(0);
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file_.close();
+    return !file_.fail();
+}
+
+std::unique_ptr<ICursor> OpenReplaySegment(const std::string& path, bool verify_checksum) {
+    auto cursor = std::make_unique<ReplaySegmentCursor>();
+    if (!cursor->Open(path, verify_checksum)) {
+        return nullptr;
+    }
+    return cursor;
+}
+
+} // namespace durastash
@@ -1,12 +1,241 @@
 #include "durastash/rocksdb_storage.h"
+#include "durastash/memory_budget.h"
 #include <rocksdb/iterator.h>
 #include <rocksdb/status.h>
+#include <rocksdb/merge_operator.h>
+#include <rocksdb/table.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/write_buffer_manager.h>
+#include <rocksdb/rate_limiter.h>
+#include <rocksdb/sst_file_writer.h>
+#include <rocksdb/sst_file_reader.h>
+#include <rocksdb/utilities/table_properties_collectors.h>
+#include <rocksdb/utilities/checkpoint.h>
+#include <rocksdb/utilities/backup_engine.h>
 #include <algorithm>
+#include <cstring>
+#include <limits>
 
 namespace durastash {
 
-RocksDBStorage::RocksDBStorage() {
+namespace {
+
+// 호출자 버퍼를 복사 없이 RocksDB 슬라이스로 전달
+inline rocksdb::Slice ToSlice(std::string_view value) {
+    return rocksdb::Slice(value.data(), value.size());
+}
+
+// 카운터 값 인코딩 (8바이트 고정 길이)
+std::string EncodeCounter(int64_t value) {
+    std::string encoded(sizeof(value), '\0');
+    std::memcpy(encoded.data(), &value, sizeof(value));
+    return encoded;
+}
+
+bool DecodeCounter(const rocksdb::Slice& encoded, int64_t& value) {
+    if (encoded.size() != sizeof(value)) {
+        return false;
+    }
+    std::memcpy(&value, encoded.data(), sizeof(value));
+    return true;
+}
+
+/**
+ * 카운터 병합 연산자 (int64 덧셈)
+ * 읽기-수정-쓰기 없이 참조 카운트 등을 증감하기 위해 사용
+ */
+class CounterAddOperator : public rocksdb::AssociativeMergeOperator {
+public:
+    bool Merge(const rocksdb::Slice& /*key*/,
+               const rocksdb::Slice* existing_value,
+               const rocksdb::Slice& value,
+               std::string* new_value,
+               rocksdb::Logger* /*logger*/) const override {
+        int64_t existing = 0;
+        if (existing_value && !DecodeCounter(*existing_value, existing)) {
+            existing = 0;  // 손상된 값은 0으로 간주
+        }
+
+        int64_t delta = 0;
+        if (!DecodeCounter(value, delta)) {
+            return false;
+        }
+
+        *new_value = EncodeCounter(existing + delta);
+        return true;
+    }
+
+    const char* Name() const override {
+        return "DuraStashCounterAddOperator";
+    }
+};
+
+rocksdb::CompressionType ToRocksDBCompression(Compression compression) {
+    switch (compression) {
+        case Compression::SNAPPY: return rocksdb::kSnappyCompression;
+        case Compression::LZ4: return rocksdb::kLZ4Compression;
+        case Compression::ZSTD: return rocksdb::kZSTD;
+        case Compression::NONE:
+        default: return rocksdb::kNoCompression;
+    }
+}
+
+/**
+ * RocksDB 반복자 기반 커서
+ * 상한은 iterate_upper_bound로 지정하여 범위 밖 키(삭제 마커 포함)를 읽지 않음
+ */
+class RocksDBCursor : public ICursor {
+public:
+    RocksDBCursor(rocksdb::DB* db,
+                  const rocksdb::ReadOptions& read_options,
+                  const std::string& lower_bound,
+                  const std::string& upper_bound,
+                  bool tailing)
+        : db_(db)
+        , lower_bound_(lower_bound)
+        , upper_bound_(upper_bound)
+        , upper_bound_slice_(upper_bound_)
+        , read_options_(read_options) {
+        read_options_.tailing = tailing;
+        read_options_.iterate_upper_bound = &upper_bound_slice_;
+        iterator_.reset(db_->NewIterator(read_options_));
+    }
+
+    void Seek(const std::string& key) override {
+        // 하한은 테일링 반복자에서 지원되지 않으므로 Seek 위치로 보장
+        iterator_->Seek(key < lower_bound_ ? lower_bound_ : key);
+    }
+
+    bool Valid() const override {
+        return iterator_->Valid();
+    }
+
+    void Next() override {
+        iterator_->Next();
+    }
+
+    std::string_view Key() const override {
+        rocksdb::Slice key = iterator_->key();
+        return std::string_view(key.data(), key.size());
+    }
+
+    std::string_view Value() const override {
+        rocksdb::Slice value = iterator_->value();
+        return std::string_view(value.data(), value.size());
+    }
+
+    bool Refresh() override {
+        // 테일링 반복자는 Seek 시 최신 데이터를 반영하므로 갱신 불필요
+        if (read_options_.tailing) {
+            return true;
+        }
+        return iterator_->Refresh().ok();
+    }
+
+private:
+    rocksdb::DB* db_;
+    std::string lower_bound_;
+    std::string upper_bound_;
+    rocksdb::Slice upper_bound_slice_;
+    rocksdb::ReadOptions read_options_;
+    std::unique_ptr<rocksdb::Iterator> iterator_;
+};
+
+/**
+ * SstFileWriter 기반 외부 파일 작성기
+ */
+class RocksDBExternalFileWriter : public IExternalFileWriter {
+public:
+    explicit RocksDBExternalFileWriter(Compression compression)
+        : writer_(rocksdb::EnvOptions(), MakeOptions(compression)) {
+    }
+
+    bool Open(const std::string& path) override {
+        return writer_.Open(path).ok();
+    }
+
+    bool Put(const std::string& key, const std::string& value) override {
+        return writer_.Put(key, value).ok();
+    }
+
+    bool Finish() override {
+        return writer_.Finish().ok();
+    }
+
+private:
+    rocksdb::SstFileWriter writer_;
+
+    static rocksdb::Options MakeOptions(Compression compression) {
+        rocksdb::Options options;
+        options.compression = ToRocksDBCompression(compression);
+        return options;
+    }
+};
+
+/**
+ * SstFileReader 기반 외부 파일 커서 (읽기 전용, 갱신 불필요)
+ */
+class RocksDBExternalFileCursor : public ICursor {
+public:
+    RocksDBExternalFileCursor()
+        : reader_(rocksdb::Options()) {
+    }
+
+    bool Open(const std::string& path) {
+        if (!reader_.Open(path).ok()) {
+            return false;
+        }
+        iterator_.reset(reader_.NewIterator(rocksdb::ReadOptions()));
+        return iterator_ != nullptr;
+    }
+
+    void Seek(const std::string& key) override {
+        iterator_->Seek(key);
+    }
+
+    bool Valid() const override {
+        return iterator_->Valid();
+    }
+
+    void Next() override {
+        iterator_->Next();
+    }
+
+    std::string_view Key() const override {
+        rocksdb::Slice key = iterator_->key();
+        return std::string_view(key.data(), key.size());
+    }
+
+    std::string_view Value() const override {
+        rocksdb::Slice value = iterator_->value();
+        return std::string_view(value.data(), value.size());
+    }
+
+    bool Refresh() override {
+        return true;  // 불변 파일
+    }
+
+private:
+    rocksdb::SstFileReader reader_;
+    std::unique_ptr<rocksdb::Iterator> iterator_;
+};
+
+} // namespace
+
+RocksDBStorage::RocksDBStorage(const StorageOptions& options)
+    : options_(options) {
     write_options_.sync = true;  // 고가용성을 위한 동기 쓰기
+
+    // 범위 읽기용 readahead/비동기 I/O
+    scan_options_.readahead_size = options_.readahead_size;
+    scan_options_.adaptive_readahead = options_.adaptive_readahead;
+    scan_options_.async_io = options_.async_io;
+
+    // 읽기도 속도 제한 대상이면 포그라운드 읽기를 최우선 순위(IO_USER)로 청구
+    if (options_.rate_limit_bytes_per_sec > 0 && options_.rate_limit_reads) {
+        read_options_.rate_limiter_priority = rocksdb::Env::IO_USER;
+        scan_options_.rate_limiter_priority = rocksdb::Env::IO_USER;
+    }
 }
 
 RocksDBStorage::~RocksDBStorage() {
@@ -26,14 +255,73 @@ bool RocksDBStorage::Initialize(const std::string& db_path) {
     
     // 성능 최적화 옵션
     options.IncreaseParallelism();
-    options.OptimizeLevelStyleCompaction();
+    ApplyCompactionProfile(options);
     
     // 고가용성 옵션
     options.paranoid_checks = true;
-    options.write_buffer_size = 64 * 1024 * 1024;  // 64MB
+    options.write_buffer_size = options_.write_buffer_size;
     options.max_write_buffer_number = 3;
     options.min_write_buffer_number_to_merge = 1;
 
+    // 오픈 시간 옵션 (SST 파일이 많은 저장소)
+    options.max_open_files = options_.max_open_files;
+    options.skip_stats_update_on_db_open = options_.skip_stats_update_on_db_open;
+    options.skip_checking_sst_file_sizes_on_db_open = options_.skip_checking_sst_file_sizes_on_db_open;
+    options.max_file_opening_threads = options_.max_file_opening_threads;
+
+    // 공유 메모리 예산: 메모리 테이블과 블록 캐시(인덱스/필터 포함)를 공유 캐시에 청구
+    if (options_.memory_budget) {
+        options.write_buffer_manager = options_.memory_budget->GetWriteBufferManager();
+        options.write_buffer_size = std::min(options.write_buffer_size,
+                                             options_.memory_budget->GetWriteBufferLimit());
+
+        rocksdb::BlockBasedTableOptions table_options;
+        table_options.block_cache = options_.memory_budget->GetBlockCache();
+        table_options.cache_index_and_filter_blocks = true;
+        options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+    }
+
+    // 백그라운드 I/O 속도 제한 (플러시는 IO_HIGH, 컴팩션은 IO_LOW 우선순위로 청구됨)
+    if (options_.rate_limit_bytes_per_sec > 0) {
+        rate_limiter_.reset(rocksdb::NewGenericRateLimiter(
+            options_.rate_limit_bytes_per_sec,
+            100 * 1000,  // refill 주기 100ms
+            10,          // fairness
+            options_.rate_limit_reads ? rocksdb::RateLimiter::Mode::kAllIo
+                                      : rocksdb::RateLimiter::Mode::kWritesOnly,
+            options_.rate_limiter_auto_tuned));
+        options.rate_limiter = rate_limiter_;
+        // 대량 쓰기를 잘게 나누어 동기화하여 I/O 버스트 완화
+        options.bytes_per_sync = 1024 * 1024;
+    }
+
+    // 삭제 마커가 몰린 SST 파일을 우선 컴팩션 대상으로 표시 (큐 헤드의 ACK 삭제 마커 제거)
+    if (options_.deletion_compaction_window > 0 && options_.deletion_compaction_trigger > 0) {
+        options.table_properties_collector_factories.emplace_back(
+            rocksdb::NewCompactOnDeletionCollectorFactory(options_.deletion_compaction_window,
+                                                          options_.deletion_compaction_trigger,
+                                                          options_.deletion_compaction_ratio));
+    }
+
+    // 카운터 키용 병합 연산자
+    options.merge_operator = std::make_shared<CounterAddOperator>();
+
+    // BlobDB: 큰 페이로드를 blob 파일로 분리하여 컴팩션 재기록 방지
+    if (options_.enable_blob_files) {
+        options.enable_blob_files = true;
+        options.min_blob_size = options_.min_blob_size;
+        options.blob_file_size = options_.blob_file_size;
+        options.blob_compression_type = ToRocksDBCompression(options_.blob_compression);
+        options.enable_blob_garbage_collection = options_.enable_blob_garbage_collection;
+        options.blob_garbage_collection_age_cutoff = options_.blob_garbage_collection_age_cutoff;
+    }
+
+    // 통계 수집
+    if (options_.enable_statistics) {
+        statistics_ = rocksdb::CreateDBStatistics();
+        options.statistics = statistics_;
+    }
+
     rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db_);
     
     if (!status.ok()) {
@@ -44,6 +332,20 @@ bool RocksDBStorage::Initialize(const std::string& db_path) {
     return true;
 }
 
+void RocksDBStorage::ApplyCompactionProfile(rocksdb::Options& options) const {
+    switch (options_.compaction_profile) {
+        case CompactionProfile::UNIVERSAL:
+            // 정렬된 run 단위 병합으로 곧 삭제될 데이터를 레벨마다 다시 쓰지 않음
+            options.OptimizeUniversalStyleCompaction();
+            break;
+        case CompactionProfile::LEVELED:
+        default:
+            options.OptimizeLevelStyleCompaction();
+            options.level_compaction_dynamic_level_bytes = true;
+            break;
+    }
+}
+
 void RocksDBStorage::Shutdown() {
     std::lock_guard<std::mutex> lock(mutex_);
     
@@ -58,40 +360,79 @@ void RocksDBStorage::Shutdown() {
     initialized_ = false;
 }
 
-bool RocksDBStorage::Put(const std::string& key, const std::string& value) {
+bool RocksDBStorage::Put(std::string_view key, std::string_view value) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (!initialized_ || !db_) {
         return false;
     }
 
-    rocksdb::Status status = db_->Put(write_options_, key, value);
+    rocksdb::Status status = db_->Put(write_options_, ToSlice(key), ToSlice(value));
     return status.ok();
 }
 
-bool RocksDBStorage::Get(const std::string& key, std::string& value) {
+bool RocksDBStorage::Get(std::string_view key, std::string& value) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (!initialized_ || !db_) {
         return false;
     }
 
-    rocksdb::Status status = db_->Get(read_options_, key, &value);
+    rocksdb::Status status = db_->Get(read_options_, ToSlice(key), &value);
     return status.ok();
 }
 
-bool RocksDBStorage::Delete(const std::string& key) {
+bool RocksDBStorage::Delete(std::string_view key) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (!initialized_ || !db_) {
         return false;
     }
 
-    rocksdb::Status status = db_->Delete(write_options_, key);
+    rocksdb::Status status = db_->Delete(write_options_, ToSlice(key));
     return status.ok();
 }
 
-bool RocksDBStorage::Exists(const std::string& key) {
+bool RocksDBStorage::DeleteRange(std::string_view start_key, std::string_view end_key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!initialized_ || !db_) {
+        return false;
+    }
+
+    rocksdb::Status status = db_->DeleteRange(write_options_, db_->DefaultColumnFamily(),
+                                              ToSlice(start_key), ToSlice(end_key));
+    return status.ok();
+}
+
+bool RocksDBStorage::MergeCounter(std::string_view key, int64_t delta) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!initialized_ || !db_) {
+        return false;
+    }
+
+    rocksdb::Status status = db_->Merge(write_options_, ToSlice(key), EncodeCounter(delta));
+    return status.ok();
+}
+
+bool RocksDBStorage::GetCounter(std::string_view key, int64_t& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!initialized_ || !db_) {
+        return false;
+    }
+
+    std::string encoded;
+    rocksdb::Status status = db_->Get(read_options_, ToSlice(key), &encoded);
+    if (!status.ok()) {
+        return false;
+    }
+
+    return DecodeCounter(encoded, value);
+}
+
+bool RocksDBStorage::Exists(std::string_view key) {
     std::string value;
     return Get(key, value);
 }
@@ -110,7 +451,7 @@ size_t RocksDBStorage::Scan(const std::string& start_key,
         return 0;
     }
 
-    std::unique_ptr<rocksdb::Iterator> it(db_->NewIterator(read_options_));
+    std::unique_ptr<rocksdb::Iterator> it(db_->NewIterator(scan_options_));
     
     size_t count = 0;
     for (it->Seek(start_key); 
@@ -141,7 +482,7 @@ size_t RocksDBStorage::ScanPrefix(const std::string& prefix,
         return 0;
     }
 
-    std::unique_ptr<rocksdb::Iterator> it(db_->NewIterator(read_options_));
+    std::unique_ptr<rocksdb::Iterator> it(db_->NewIterator(scan_options_));
     
     size_t count = 0;
     std::string prefix_end = prefix;
@@ -162,6 +503,210 @@ size_t RocksDBStorage::ScanPrefix(const std::string& prefix,
     return count;
 }
 
+std::unique_ptr<ICursor> RocksDBStorage::NewCursor(const std::string& lower_bound,
+                                                   const std::string& upper_bound,
+                                                   bool tailing) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!initialized_ || !db_) {
+        return nullptr;
+    }
+
+    return std::make_unique<RocksDBCursor>(db_.get(), scan_options_, lower_bound, upper_bound, tailing);
+}
+
+bool RocksDBStorage::Flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!initialized_ || !db_) {
+        return false;
+    }
+
+    rocksdb::FlushOptions flush_options;
+    flush_options.wait = true;
+    return db_->Flush(flush_options).ok();
+}
+
+rocksdb::DB* RocksDBStorage::GetDB() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!initialized_ || !db_) {
+        return nullptr;
+    }
+    return db_.get();
+}
+
+bool RocksDBStorage::CompactRange(const std::string& start_key, const std::string& end_key) {
+    // 컴팩션 중에도 다른 작업이 진행되도록 잠금 없이 실행 (DB 자체는 스레드 안전)
+    rocksdb::DB* db = GetDB();
+    if (!db) {
+        return false;
+    }
+
+    rocksdb::CompactRangeOptions compact_options;
+    compact_options.exclusive_manual_compaction = false;
+    compact_options.bottommost_level_compaction = rocksdb::BottommostLevelCompaction::kForceOptimized;
+
+    rocksdb::Slice begin(start_key);
+    rocksdb::Slice end(end_key);
+    return db->CompactRange(compact_options, &begin, &end).ok();
+}
+
+bool RocksDBStorage::GetStats(StorageStats& stats) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    stats = StorageStats();
+    
+    if (!initialized_ || !db_) {
+        return false;
+    }
+
+    if (statistics_) {
+        stats.user_bytes_written = statistics_->getTickerCount(rocksdb::BYTES_WRITTEN);
+        stats.flush_bytes_written = statistics_->getTickerCount(rocksdb::FLUSH_WRITE_BYTES);
+        stats.compaction_bytes_written = statistics_->getTickerCount(rocksdb::COMPACT_WRITE_BYTES);
+        stats.compaction_bytes_read = statistics_->getTickerCount(rocksdb::COMPACT_READ_BYTES);
+        stats.blob_bytes_written = statistics_->getTickerCount(rocksdb::BLOB_DB_BLOB_FILE_BYTES_WRITTEN);
+    }
+
+    db_->GetIntProperty("rocksdb.total-sst-files-size", &stats.sst_files_size);
+    db_->GetIntProperty("rocksdb.total-blob-file-size", &stats.blob_files_size);
+    db_->GetIntProperty("rocksdb.estimate-live-data-size", &stats.live_data_size);
+    db_->GetIntProperty("rocksdb.cur-size-all-mem-tables", &stats.memtable_bytes);
+    db_->GetIntProperty("rocksdb.estimate-table-readers-mem", &stats.table_readers_bytes);
+    db_->GetIntProperty("rocksdb.block-cache-usage", &stats.block_cache_bytes);
+
+    if (rate_limiter_) {
+        stats.rate_limit_bytes_per_sec = rate_limiter_->GetBytesPerSecond();
+        stats.rate_limited_bytes = rate_limiter_->GetTotalBytesThrough();
+    }
+    return true;
+}
+
+bool RocksDBStorage::CreateCheckpoint(const std::string& checkpoint_dir) {
+    // 잠금 없이 실행하여 체크포인트 생성 중에도 쓰기가 진행되도록 함
+    rocksdb::DB* db = GetDB();
+    if (!db) {
+        return false;
+    }
+
+    rocksdb::Checkpoint* raw_checkpoint = nullptr;
+    if (!rocksdb::Checkpoint::Create(db, &raw_checkpoint).ok()) {
+        return false;
+    }
+    std::unique_ptr<rocksdb::Checkpoint> checkpoint(raw_checkpoint);
+
+    // 메모리 테이블을 플러시하지 않고 WAL을 복사하여 일관성 확보 (SST는 하드 링크)
+    return checkpoint->CreateCheckpoint(checkpoint_dir, std::numeric_limits<uint64_t>::max()).ok();
+}
+
+bool RocksDBStorage::CreateBackup(const std::string& backup_dir, BackupInfo* info) {
+    rocksdb::DB* db = GetDB();
+    if (!db) {
+        return false;
+    }
+
+    rocksdb::BackupEngine* raw_engine = nullptr;
+    rocksdb::BackupEngineOptions engine_options(backup_dir);
+    engine_options.share_table_files = true;  // 증분 백업 (SST 파일 공유)
+    if (!rocksdb::BackupEngine::Open(engine_options, rocksdb::Env::Default(), &raw_engine).ok()) {
+        return false;
+    }
+    std::unique_ptr<rocksdb::BackupEngine> engine(raw_engine);
+
+    // 플러시 없이 WAL 포함 백업 (쓰기 중단 없음)
+    rocksdb::CreateBackupOptions backup_options;
+    backup_options.flush_before_backup = false;
+    rocksdb::BackupID backup_id = 0;
+    if (!engine->CreateNewBackup(backup_options, db, &backup_id).ok()) {
+        return false;
+    }
+
+    if (info) {
+        std::vector<rocksdb::BackupInfo> backups;
+        engine->GetBackupInfo(&backups);
+        for (const auto& backup : backups) {
+            if (backup.backup_id == backup_id) {
+                info->backup_id = backup.backup_id;
+                info->timestamp = backup.timestamp;
+                info->size = backup.size;
+                info->number_files = backup.number_files;
+            }
+        }
+    }
+    return true;
+}
+
+bool RocksDBStorage::RestoreLatestBackup(const std::string& backup_dir, const std::string& db_path) {
+    rocksdb::BackupEngine* raw_engine = nullptr;
+    rocksdb::BackupEngineOptions engine_options(backup_dir);
+    if (!rocksdb::BackupEngine::Open(engine_options, rocksdb::Env::Default(), &raw_engine).ok()) {
+        return false;
+    }
+    std::unique_ptr<rocksdb::BackupEngine> engine(raw_engine);
+
+    return engine->RestoreDBFromLatestBackup(db_path, db_path).ok();
+}
+
+std::vector<BackupInfo> RocksDBStorage::ListBackups(const std::string& backup_dir) {
+    std::vector<BackupInfo> results;
+    
+    rocksdb::BackupEngine* raw_engine = nullptr;
+    rocksdb::BackupEngineOptions engine_options(backup_dir);
+    if (!rocksdb::BackupEngine::Open(engine_options, rocksdb::Env::Default(), &raw_engine).ok()) {
+        return results;
+    }
+    std::unique_ptr<rocksdb::BackupEngine> engine(raw_engine);
+
+    std::vector<rocksdb::BackupInfo> backups;
+    engine->GetBackupInfo(&backups);
+    for (const auto& backup : backups) {
+        BackupInfo info;
+        info.backup_id = backup.backup_id;
+        info.timestamp = backup.timestamp;
+        info.size = backup.size;
+        info.number_files = backup.number_files;
+        results.push_back(info);
+    }
+    return results;
+}
+
+bool RocksDBStorage::PurgeOldBackups(const std::string& backup_dir, uint32_t num_backups_to_keep) {
+    rocksdb::BackupEngine* raw_engine = nullptr;
+    rocksdb::BackupEngineOptions engine_options(backup_dir);
+    if (!rocksdb::BackupEngine::Open(engine_options, rocksdb::Env::Default(), &raw_engine).ok()) {
+        return false;
+    }
+    std::unique_ptr<rocksdb::BackupEngine> engine(raw_engine);
+
+    return engine->PurgeOldBackups(num_backups_to_keep).ok();
+}
+
+std::unique_ptr<IExternalFileWriter> RocksDBStorage::NewExternalFileWriter(Compression compression) {
+    return std::make_unique<RocksDBExternalFileWriter>(compression);
+}
+
+std::unique_ptr<ICursor> RocksDBStorage::OpenExternalFile(const std::string& path) {
+    auto cursor = std::make_unique<RocksDBExternalFileCursor>();
+    if (!cursor->Open(path)) {
+        return nullptr;
+    }
+    return cursor;
+}
+
+bool RocksDBStorage::IngestExternalFiles(const std::vector<std::string>& paths, bool move_files) {
+    // 수집은 파일 단위 원자 작업이며 잠금 없이 실행 (겹치는 메모리 테이블은 RocksDB가 플러시)
+    rocksdb::DB* db = GetDB();
+    if (!db) {
+        return false;
+    }
+
+    rocksdb::IngestExternalFileOptions ingest_options;
+    ingest_options.move_files = move_files;
+    ingest_options.failed_move_fall_back_to_copy = true;
+    return db->IngestExternalFile(paths, ingest_options).ok();
+}
+
 bool RocksDBStorage::BeginBatch() {
     std::lock_guard<std::mutex> lock(mutex_);
     
@@ -177,19 +722,35 @@ bool RocksDBStorage::BeginBatch() {
     return true;
 }
 
-void RocksDBStorage::PutToBatch(const std::string& key, const std::string& value) {
+void RocksDBStorage::PutToBatch(std::string_view key, std::string_view value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (current_batch_) {
+        current_batch_->Put(ToSlice(key), ToSlice(value));
+    }
+}
+
+void RocksDBStorage::DeleteFromBatch(std::string_view key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (current_batch_) {
+        current_batch_->Delete(ToSlice(key));
+    }
+}
+
+void RocksDBStorage::DeleteRangeFromBatch(std::string_view start_key, std::string_view end_key) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (current_batch_) {
-        current_batch_->Put(key, value);
+        current_batch_->DeleteRange(ToSlice(start_key), ToSlice(end_key));
     }
 }
 
-void RocksDBStorage::DeleteFromBatch(const std::string& key) {
+void RocksDBStorage::MergeCounterToBatch(std::string_view key, int64_t delta) {
     std::lock_guard<std::mutex> lock(mutex_);
     
     if (current_batch_) {
-        current_batch_->Delete(key);
+        current_batch_->Merge(ToSlice(key), EncodeCounter(delta));
     }
 }
 
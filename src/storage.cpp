@@ -1,10 +1,23 @@
 #include "durastash/storage.h"
 #include "durastash/rocksdb_storage.h"
+#include "durastash/options.h"
 
 namespace durastash {
 
-std::unique_ptr<IStorage> CreateStorage() {
-    return std::make_unique<RocksDBStorage>();
+std::unique_ptr<IStorage> CreateStorage(const StorageOptions& options) {
+    return std::make_unique<RocksDBStorage>(options);
+}
+
+bool RestoreLatestBackup(const std::string& backup_dir, const std::string& db_path) {
+    return RocksDBStorage::RestoreLatestBackup(backup_dir, db_path);
+}
+
+std::vector<BackupInfo> ListBackups(const std::string& backup_dir) {
+    return RocksDBStorage::ListBackups(backup_dir);
+}
+
+bool PurgeOldBackups(const std::string& backup_dir, uint32_t num_backups_to_keep) {
+    return RocksDBStorage::PurgeOldBackups(backup_dir, num_backups_to_keep);
 }
 
 } // namespace durastash
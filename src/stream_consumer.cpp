@@ -0,0 +1,61 @@
+#include "durastash/stream_consumer.h"
+#include "durastash/checksum.h"
+#include "durastash/errors.h"
+#include "durastash/key_format.h"
+
+namespace durastash {
+
+StreamConsumer::StreamConsumer(std::unique_ptr<ICursor> cursor,
+                               std::string data_prefix,
+                               DedupManager* dedup_manager,
+                               bool checksums)
+    : cursor_(std::move(cursor))
+    , data_prefix_(std::move(data_prefix))
+    , dedup_manager_(dedup_manager)
+    , checksums_(checksums) {
+}
+
+std::vector<std::string> StreamConsumer::Poll(size_t max_count) {
+    std::vector<std::string> results;
+    
+    if (!cursor_ || !cursor_->Refresh()) {
+        return results;
+    }
+
+    // 마지막 전달 위치에서 재개 (테일링 커서는 Seek 시 새로 추가된 키를 반영)
+    if (last_key_.empty()) {
+        cursor_->Seek(data_prefix_);
+    } else {
+        cursor_->Seek(last_key_);
+        if (cursor_->Valid() && cursor_->Key() == last_key_) {
+            cursor_->Next();
+        }
+    }
+
+    for (; cursor_->Valid(); cursor_->Next()) {
+        if (max_count > 0 && results.size() >= max_count) {
+            break;
+        }
+
+        std::string_view key = cursor_->Key();
+        last_key_.assign(key.data(), key.size());
+        KeyFormat::ParseKeySequence(key, last_sequence_);
+
+        std::string value(cursor_->Value());
+        uint32_t expected = 0;
+        if (checksums_ && !Checksum::SplitRecordChecksum(value, expected)) {
+            throw CorruptedBatchException(last_key_);
+        }
+        if (dedup_manager_ && !dedup_manager_->Resolve(value)) {
+            continue;  // 참조 대상이 이미 정리됨 (ACK 후 가비지 컬렉션)
+        }
+        if (checksums_ && Checksum::Crc32c(value) != expected) {
+            throw CorruptedBatchException(last_key_);
+        }
+        results.push_back(std::move(value));
+    }
+
+    return results;
+}
+
+} // namespace durastash
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <algorithm>
 #include <cstring>
+#include <mutex>
 
 namespace durastash {
 
@@ -25,6 +26,22 @@ std::string ULID::Generate(uint64_t timestamp) {
     return std::string(buffer);
 }
 
+std::string ULID::GenerateMonotonic() {
+    static std::mutex mutex;
+    static std::string last;
+    
+    std::string ulid = Generate();
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    // Base32 문자는 ASCII 오름차순이므로 문자열 비교가 곧 ULID 순서
+    if (ulid <= last) {
+        ulid = last;
+        Increment(ulid);
+    }
+    last = ulid;
+    return ulid;
+}
+
 uint64_t ULID::ExtractTimestamp(const std::string& ulid) {
     if (!IsValid(ulid)) {
         return 0;
@@ -96,6 +113,19 @@ void ULID::EncodeRandom(char* buffer) {
     }
 }
 
+void ULID::Increment(std::string& ulid) {
+    // 마지막 문자부터 자리올림하며 1 증가
+    for (size_t i = ulid.size(); i > 0; --i) {
+        const char* pos = std::strchr(ENCODING_CHARS, ulid[i - 1]);
+        size_t value = pos ? static_cast<size_t>(pos - ENCODING_CHARS) : 0;
+        if (value + 1 < 32) {
+            ulid[i - 1] = ENCODING_CHARS[value + 1];
+            return;
+        }
+        ulid[i - 1] = ENCODING_CHARS[0];
+    }
+}
+
 uint64_t ULID::DecodeTimestamp(const std::string& ulid) {
     return DecodeBase32(ulid, 0, TIMESTAMP_LENGTH);
 }
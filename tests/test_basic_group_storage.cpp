@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include "durastash/basic_group_storage.h"
+#include "durastash/rocksdb_storage.h"
+#include "test_utils.h"
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace durastash;
+using namespace durastash::test_utils;
+
+// Windows에서 콘솔 출력 인코딩을 UTF-8로 설정
+namespace {
+    struct ConsoleEncodingSetter {
+        ConsoleEncodingSetter() {
+#ifdef _WIN32
+            SetConsoleOutputCP(65001);
+            SetConsoleCP(65001);
+#endif
+        }
+    };
+    ConsoleEncodingSetter g_console_encoding_setter;
+}
+
+using MemoryGroupStorage = BasicGroupStorage<MemoryBackend, BinaryMetadataCodec, NullLockPolicy>;
+
+TEST(BasicGroupStorageTest, SaveAndLoadFIFO) {
+    MemoryGroupStorage storage;
+    storage.SetBatchSize(4);
+    ASSERT_TRUE(storage.InitializeSession("group"));
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(storage.Save("group", "data_" + std::to_string(i)));
+    }
+
+    auto data = storage.Load("group");
+    ASSERT_EQ(data.size(), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(data[i], "data_" + std::to_string(i));
+    }
+
+    // 10개 데이터 + 정렬된 범위 배치 3개의 메타데이터
+    EXPECT_EQ(storage.GetBackend().Size(), 13u);
+    EXPECT_TRUE(storage.Load("unknown").empty());
+}
+
+TEST(BasicGroupStorageTest, LoadBatchOnceAndAcknowledge) {
+    MemoryGroupStorage storage;
+    storage.SetBatchSize(5);
+    ASSERT_TRUE(storage.InitializeSession("group"));
+    for (int i = 0; i < 12; ++i) {
+        ASSERT_TRUE(storage.Save("group", "data_" + std::to_string(i)));
+    }
+
+    auto batches = storage.LoadBatch("group", 2);
+    ASSERT_EQ(batches.size(), 2u);
+    EXPECT_EQ(batches[0].sequence_start, 0);
+    EXPECT_EQ(batches[0].sequence_end, 4);
+    ASSERT_EQ(batches[0].data.size(), 5u);
+    EXPECT_EQ(batches[0].data[0], "data_0");
+    EXPECT_EQ(batches[1].sequence_start, 5);
+    EXPECT_EQ(batches[1].data[4], "data_9");
+
+    // 이미 로드된 배치는 다시 로드되지 않음
+    auto rest = storage.LoadBatch("group", 10);
+    ASSERT_EQ(rest.size(), 1u);
+    EXPECT_EQ(rest[0].data.size(), 2u);
+    EXPECT_TRUE(storage.LoadBatch("group", 10).empty());
+
+    ASSERT_TRUE(storage.AcknowledgeBatch("group", batches[0].batch_id));
+    EXPECT_FALSE(storage.AcknowledgeBatch("group", batches[0].batch_id));
+
+    auto remaining = storage.Load("group");
+    ASSERT_EQ(remaining.size(), 7u);
+    EXPECT_EQ(remaining[0], "data_5");
+}
+
+TEST(BasicGroupStorageTest, NewSessionHidesPreviousData) {
+    MemoryGroupStorage storage;
+    ASSERT_TRUE(storage.Save("group", "old"));
+    std::string first_session = storage.GetSessionId("group");
+    EXPECT_FALSE(first_session.empty());
+
+    ASSERT_TRUE(storage.InitializeSession("group"));
+    EXPECT_NE(storage.GetSessionId("group"), first_session);
+    ASSERT_TRUE(storage.Save("group", "new"));
+
+    auto data = storage.Load("group");
+    ASSERT_EQ(data.size(), 1u);
+    EXPECT_EQ(data[0], "new");
+}
+
+TEST(BasicGroupStorageTest, BinaryCodecRoundTrip) {
+    BatchMetadata metadata;
+    metadata.SetBatchId("01ARZ3NDEKTSV4RRFFQ69G5FAV");
+    metadata.SetSequenceStart(100);
+    metadata.SetSequenceEnd(199);
+    metadata.SetStatus(BatchStatus::LOADED);
+    metadata.SetCreatedAt(1234567890123);
+    metadata.SetLoadedAt(1234567890456);
+
+    std::string encoded;
+    BinaryMetadataCodec::Encode(metadata, encoded);
+    EXPECT_EQ(encoded.size(), BinaryMetadataCodec::ENCODED_SIZE);
+
+    BatchMetadata decoded;
+    ASSERT_TRUE(BinaryMetadataCodec::Decode(encoded, decoded));
+    EXPECT_EQ(decoded.GetBatchId(), metadata.GetBatchId());
+    EXPECT_EQ(decoded.GetSequenceStart(), 100);
+    EXPECT_EQ(decoded.GetSequenceEnd(), 199);
+    EXPECT_EQ(decoded.GetStatus(), BatchStatus::LOADED);
+    EXPECT_EQ(decoded.GetCreatedAt(), 1234567890123);
+    EXPECT_EQ(decoded.GetLoadedAt(), 1234567890456);
+
+    // 길이가 다르거나 상태 값이 잘못되면 실패
+    EXPECT_FALSE(BinaryMetadataCodec::Decode(encoded.substr(1), decoded));
+    encoded.back() = 7;
+    EXPECT_FALSE(BinaryMetadataCodec::Decode(encoded, decoded));
+}
+
+TEST(BasicGroupStorageTest, CorruptedMetadataThrows) {
+    MemoryGroupStorage storage;
+    ASSERT_TRUE(storage.Save("group", "data"));
+
+    std::string prefix = "group:" + storage.GetSessionId("group") + ":batch:";
+    std::string batch_key;
+    storage.GetBackend().Scan(prefix, "group:" + storage.GetSessionId("group") + ":batch;",
+                              [&](std::string_view key, std::string_view) {
+                                  batch_key = std::string(key);
+                                  return false;
+                              });
+    ASSERT_FALSE(batch_key.empty());
+    storage.GetBackend().Put(batch_key, "garbage");
+
+    EXPECT_THROW(storage.LoadBatch("group", 1), CorruptedBatchException);
+}
+
+TEST(BasicGroupStorageTest, StorageBackendOverRocksDB) {
+    TestDirectoryGuard dir_guard("basic_group_storage");
+    RocksDBStorage rocksdb;
+    ASSERT_TRUE(rocksdb.Initialize(dir_guard.GetPathString()));
+
+    {
+        DynamicGroupStorage storage(rocksdb);
+        storage.SetBatchSize(3);
+        ASSERT_TRUE(storage.InitializeSession("group"));
+        for (int i = 0; i < 7; ++i) {
+            ASSERT_TRUE(storage.Save("group", "data_" + std::to_string(i)));
+        }
+
+        auto batches = storage.LoadBatch("group", 1);
+        ASSERT_EQ(batches.size(), 1u);
+        ASSERT_EQ(batches[0].data.size(), 3u);
+        ASSERT_TRUE(storage.AcknowledgeBatch("group", batches[0].batch_id));
+
+        auto data = storage.Load("group");
+        ASSERT_EQ(data.size(), 4u);
+        EXPECT_EQ(data[0], "data_3");
+        EXPECT_EQ(data[3], "data_6");
+
+        // JSON 메타데이터는 GroupStorage와 같은 형식
+        std::string metadata_json;
+        std::string session_id = storage.GetSessionId("group");
+        auto remaining = storage.LoadBatch("group", 1);
+        ASSERT_EQ(remaining.size(), 1u);
+        ASSERT_TRUE(rocksdb.Get("group:" + session_id + ":batch:" + remaining[0].batch_id, metadata_json));
+        BatchMetadata metadata;
+        metadata.fromJson(metadata_json);
+        EXPECT_EQ(metadata.GetStatus(), BatchStatus::LOADED);
+        EXPECT_EQ(metadata.GetSequenceStart(), 3);
+    }
+
+    rocksdb.Shutdown();
+}
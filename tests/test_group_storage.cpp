@@ -1,10 +1,16 @@
 #include <gtest/gtest.h>
 #include "durastash/group_storage.h"
+#include "durastash/replay_segment.h"
+#include "durastash/errors.h"
 #include "test_utils.h"
 #include <filesystem>
 #include <fstream>
 #include <cstdlib>
 #include <ctime>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -241,3 +247,1196 @@ TEST_F(GroupStorageTest, LoadVsLoadBatch) {
     EXPECT_EQ(values_after_ack.size(), 0); // 삭제됨
 }
 
+
+TEST_F(GroupStorageTest, ListGroups) {
+    ASSERT_TRUE(storage_->InitializeSession("group_b"));
+    ASSERT_TRUE(storage_->InitializeSession("group_a"));
+    
+    auto groups = storage_->ListGroups();
+    ASSERT_EQ(groups.size(), 2);
+    EXPECT_EQ(groups[0], "group_a");
+    EXPECT_EQ(groups[1], "group_b");
+    
+    // 재시작 후에도 레지스트리 유지
+    storage_->Shutdown();
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString());
+    ASSERT_TRUE(storage_->Initialize());
+    
+    auto reopened_groups = storage_->ListGroups();
+    ASSERT_EQ(reopened_groups.size(), 2);
+    EXPECT_EQ(reopened_groups[0], "group_a");
+    EXPECT_EQ(reopened_groups[1], "group_b");
+}
+
+TEST_F(GroupStorageTest, ReservedGroupKeys) {
+    // 시스템 키 공간과 겹치는 그룹 키는 등록 불가
+    EXPECT_FALSE(storage_->InitializeSession("__durastash__"));
+    EXPECT_FALSE(storage_->InitializeSession("__durastash__:blob"));
+    EXPECT_FALSE(storage_->Save("__durastash__:group", "data"));
+    
+    // 접두사만 비슷한 키는 허용
+    EXPECT_TRUE(storage_->InitializeSession("__durastash__x"));
+    EXPECT_TRUE(storage_->InitializeSession("__durastash"));
+    
+    auto groups = storage_->ListGroups();
+    ASSERT_EQ(groups.size(), 2);
+    EXPECT_EQ(groups[0], "__durastash");
+    EXPECT_EQ(groups[1], "__durastash__x");
+}
+
+TEST_F(GroupStorageTest, DropGroup) {
+    std::string dropped = "dropped_group";
+    std::string nested = "dropped_group:child";
+    std::string kept = "kept_group";
+    ASSERT_TRUE(storage_->InitializeSession(dropped));
+    ASSERT_TRUE(storage_->InitializeSession(nested));
+    ASSERT_TRUE(storage_->InitializeSession(kept));
+    
+    for (int i = 0; i < 10; ++i) {
+        storage_->Save(dropped, "data" + std::to_string(i));
+        storage_->Save(nested, "nested" + std::to_string(i));
+        storage_->Save(kept, "kept" + std::to_string(i));
+    }
+    
+    EXPECT_TRUE(storage_->DropGroup(dropped));
+    EXPECT_FALSE(storage_->DropGroup(dropped)); // 이미 삭제됨
+    
+    auto groups = storage_->ListGroups();
+    ASSERT_EQ(groups.size(), 2);
+    EXPECT_EQ(groups[0], nested);
+    EXPECT_EQ(groups[1], kept);
+    
+    // 삭제된 그룹은 데이터가 없고, 하위/다른 그룹은 유지
+    EXPECT_EQ(storage_->Load(dropped).size(), 0);
+    EXPECT_EQ(storage_->Load(nested).size(), 10);
+    EXPECT_EQ(storage_->Load(kept).size(), 10);
+    
+    // 삭제 후 같은 그룹 재사용 가능
+    ASSERT_TRUE(storage_->InitializeSession(dropped));
+    ASSERT_TRUE(storage_->Save(dropped, "fresh"));
+    auto values = storage_->Load(dropped);
+    ASSERT_EQ(values.size(), 1);
+    EXPECT_EQ(values[0], "fresh");
+}
+
+TEST_F(GroupStorageTest, CompactAckedHead) {
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(10);
+    
+    // ACK 전에는 컴팩션할 헤드가 없음
+    EXPECT_FALSE(storage_->CompactAckedHead(group_key));
+    
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data" + std::to_string(i)));
+    }
+    
+    auto batches = storage_->LoadBatch(group_key, 3);
+    ASSERT_EQ(batches.size(), 3);
+    for (const auto& batch : batches) {
+        ASSERT_TRUE(storage_->AcknowledgeBatch(group_key, batch.batch_id));
+    }
+    
+    ASSERT_TRUE(storage_->Flush());
+    EXPECT_TRUE(storage_->CompactAckedHead(group_key));
+    
+    // 컴팩션 후에도 ACK되지 않은 데이터는 순서대로 유지
+    auto values = storage_->Load(group_key);
+    ASSERT_EQ(values.size(), 20);
+    EXPECT_EQ(values.front(), "data30");
+    EXPECT_EQ(values.back(), "data49");
+}
+
+TEST_F(GroupStorageTest, StreamConsumerTailing) {
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(3);
+    
+    EXPECT_EQ(storage_->CreateConsumer("unknown_group"), nullptr);
+    
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data" + std::to_string(i)));
+    }
+    
+    auto consumer = storage_->CreateConsumer(group_key);
+    ASSERT_NE(consumer, nullptr);
+    EXPECT_EQ(consumer->GetLastSequence(), -1);
+    
+    // 최대 개수 제한
+    auto values = consumer->Poll(2);
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[0], "data0");
+    EXPECT_EQ(values[1], "data1");
+    
+    values = consumer->Poll();
+    ASSERT_EQ(values.size(), 3);
+    EXPECT_EQ(values[2], "data4");
+    EXPECT_EQ(consumer->GetLastSequence(), 4);
+    
+    // 새 데이터가 없으면 비어 있음
+    EXPECT_TRUE(consumer->Poll().empty());
+    
+    // 커서 생성 이후 추가된 데이터도 이어서 전달 (배치 경계 포함)
+    for (int i = 5; i < 12; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data" + std::to_string(i)));
+    }
+    values = consumer->Poll();
+    ASSERT_EQ(values.size(), 7);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], "data" + std::to_string(i + 5));
+    }
+    EXPECT_EQ(consumer->GetLastSequence(), 11);
+    
+    consumer.reset();
+}
+
+TEST_F(GroupStorageTest, IdempotentProducerSave) {
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    
+    EXPECT_TRUE(storage_->Save(group_key, "data0", "producer_a", 0));
+    EXPECT_TRUE(storage_->Save(group_key, "data1", "producer_a", 1));
+    // 타임아웃 후 재시도된 중복 (저장되지 않음)
+    EXPECT_TRUE(storage_->Save(group_key, "data1", "producer_a", 1));
+    EXPECT_TRUE(storage_->Save(group_key, "data0", "producer_a", 0));
+    // 다른 프로듀서는 독립적인 high-water mark 사용
+    EXPECT_TRUE(storage_->Save(group_key, "other0", "producer_b", 0));
+    EXPECT_TRUE(storage_->Save(group_key, "data2", "producer_a", 2));
+    
+    auto values = storage_->Load(group_key);
+    ASSERT_EQ(values.size(), 4);
+    EXPECT_EQ(values[0], "data0");
+    EXPECT_EQ(values[1], "data1");
+    EXPECT_EQ(values[2], "other0");
+    EXPECT_EQ(values[3], "data2");
+}
+
+TEST_F(GroupStorageTest, ProducerHighWaterMarkWithChildGroup) {
+    // "g:producer" 하위 그룹과 그룹 "g"의 프로듀서 high-water mark는 서로 독립
+    ASSERT_TRUE(storage_->InitializeSession("g"));
+    ASSERT_TRUE(storage_->InitializeSession("g:producer"));
+    EXPECT_TRUE(storage_->Save("g", "a0", "p", 0));
+    EXPECT_TRUE(storage_->Save("g:producer", "b0", "p", 0));
+    ASSERT_EQ(storage_->Load("g").size(), 1);
+    ASSERT_EQ(storage_->Load("g:producer").size(), 1);
+    
+    // 하위 그룹 삭제는 상위 그룹의 high-water mark를 지우지 않음 (재시작 후에도 중복 거부)
+    ASSERT_TRUE(storage_->DropGroup("g:producer"));
+    storage_->Shutdown();
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString());
+    ASSERT_TRUE(storage_->Initialize());
+    ASSERT_TRUE(storage_->InitializeSession("g"));
+    size_t before = storage_->Load("g").size();
+    EXPECT_TRUE(storage_->Save("g", "a0", "p", 0));
+    EXPECT_EQ(storage_->Load("g").size(), before);
+    
+    // 하위 그룹이 등록되어 있어도 상위 그룹 삭제는 자신의 high-water mark를 삭제
+    ASSERT_TRUE(storage_->InitializeSession("g:producer"));
+    ASSERT_TRUE(storage_->DropGroup("g"));
+    storage_->Shutdown();
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString());
+    ASSERT_TRUE(storage_->Initialize());
+    ASSERT_TRUE(storage_->InitializeSession("g"));
+    EXPECT_TRUE(storage_->Save("g", "new0", "p", 0));
+    auto values = storage_->Load("g");
+    ASSERT_EQ(values.size(), 1);
+    EXPECT_EQ(values[0], "new0");
+}
+
+TEST_F(GroupStorageTest, SaveMultiFanOut) {
+    ASSERT_TRUE(storage_->InitializeSession("all_logs"));
+    ASSERT_TRUE(storage_->InitializeSession("service_a"));
+    
+    // 세션이 없는 그룹은 자동으로 세션 생성
+    std::vector<std::pair<std::string, std::string>> entries = {
+        {"all_logs", "event1"},
+        {"service_a", "event1"},
+        {"errors", "event1"},
+        {"all_logs", "event2"},
+    };
+    EXPECT_TRUE(storage_->SaveMulti(entries));
+    
+    auto all_logs = storage_->Load("all_logs");
+    ASSERT_EQ(all_logs.size(), 2);
+    EXPECT_EQ(all_logs[0], "event1");
+    EXPECT_EQ(all_logs[1], "event2");
+    
+    auto service_a = storage_->Load("service_a");
+    ASSERT_EQ(service_a.size(), 1);
+    EXPECT_EQ(service_a[0], "event1");
+    
+    auto errors = storage_->Load("errors");
+    ASSERT_EQ(errors.size(), 1);
+    EXPECT_EQ(errors[0], "event1");
+    
+    // 이후 일반 Save는 같은 배치에 이어서 저장
+    ASSERT_TRUE(storage_->Save("all_logs", "event3"));
+    auto batches = storage_->LoadBatch("all_logs", 100);
+    ASSERT_EQ(batches.size(), 1);
+    EXPECT_EQ(batches[0].data.size(), 3);
+}
+
+TEST_F(GroupStorageTest, StringViewAndSpanOverloads) {
+    std::string group_key = "view_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    
+    // 호출자 버퍼의 일부를 임시 문자열 없이 저장 (내장 NUL 포함)
+    const char buffer[] = "header|payload\0tail|footer";
+    std::string_view whole(buffer, sizeof(buffer) - 1);
+    ASSERT_TRUE(storage_->Save(group_key, whole.substr(7, 12)));
+    
+    std::vector<std::pair<std::string, std::string_view>> entries = {
+        {group_key, whole.substr(0, 6)},
+        {group_key, whole.substr(20)},
+    };
+    ASSERT_TRUE(storage_->SaveMulti(entries));
+    
+    auto data = storage_->Load(group_key);
+    ASSERT_EQ(data.size(), 3);
+    EXPECT_EQ(data[0], std::string("payload\0tail", 12));
+    EXPECT_EQ(data[1], "header");
+    EXPECT_EQ(data[2], "footer");
+    
+    // 남은 데이터를 뷰 목록으로 Resave
+    auto batches = storage_->LoadBatch(group_key, 100);
+    ASSERT_EQ(batches.size(), 1);
+    std::vector<std::string_view> remaining = {whole.substr(0, 6)};
+    ASSERT_TRUE(storage_->ResaveBatch(group_key, batches[0].batch_id, remaining));
+    
+    auto resaved = storage_->LoadBatch(group_key, 100);
+    ASSERT_EQ(resaved.size(), 1);
+    ASSERT_EQ(resaved[0].data.size(), 1);
+    EXPECT_EQ(resaved[0].data[0], "header");
+}
+
+TEST_F(GroupStorageTest, LoadBatchIntoArena) {
+    std::string group_key = "arena_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(10);
+    
+    for (int i = 0; i < 25; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data_" + std::to_string(i) + std::string(i, 'x')));
+    }
+    
+    // 소비자가 하나의 결과를 배치마다 재사용
+    ArenaBatchLoadResult result;
+    std::vector<std::string> loaded;
+    std::set<std::string> batch_ids;
+    size_t capacity = 0;
+    while (storage_->LoadBatch(group_key, result)) {
+        EXPECT_EQ(static_cast<int64_t>(result.data.size()), result.sequence_end - result.sequence_start + 1);
+        batch_ids.insert(result.batch_id);
+        for (std::string_view payload : result.data) {
+            loaded.emplace_back(payload);
+        }
+        // Reset은 버퍼를 해제하지 않음
+        EXPECT_GE(result.data.Capacity(), capacity);
+        capacity = result.data.Capacity();
+    }
+    
+    // 마지막 열린 배치(5개)까지 순서대로 로드
+    EXPECT_EQ(batch_ids.size(), 3);
+    ASSERT_EQ(loaded.size(), 25);
+    for (int i = 0; i < 25; ++i) {
+        EXPECT_EQ(loaded[i], "data_" + std::to_string(i) + std::string(i, 'x'));
+    }
+    EXPECT_TRUE(result.data.empty());
+    
+    // 로드된 배치는 기존 LoadBatch에서도 다시 나오지 않음
+    EXPECT_TRUE(storage_->LoadBatch(group_key, 100).empty());
+    
+    // 빈 페이로드도 경계가 유지됨
+    PayloadArena arena;
+    arena.Append("a");
+    arena.Append("");
+    arena.Append("bc");
+    ASSERT_EQ(arena.size(), 3);
+    EXPECT_EQ(arena[0], "a");
+    EXPECT_EQ(arena[1], "");
+    EXPECT_EQ(arena[2], "bc");
+    EXPECT_EQ(arena.Bytes(), 3);
+}
+
+TEST_F(GroupStorageTest, EvictIdleGroupsAndRestore) {
+    storage_->SetBatchSize(10);
+    std::vector<std::string> group_keys = {"idle_a", "idle_b"};
+    std::vector<std::string> session_ids;
+    for (const auto& group_key : group_keys) {
+        ASSERT_TRUE(storage_->InitializeSession(group_key));
+        session_ids.push_back(storage_->GetSessionId(group_key));
+        for (int i = 0; i < 15; ++i) {
+            ASSERT_TRUE(storage_->Save(group_key, group_key + "_" + std::to_string(i)));
+        }
+    }
+    
+    EXPECT_EQ(storage_->EvictIdleGroups(60000), 0);
+    EXPECT_EQ(storage_->EvictIdleGroups(0), 2);
+    EXPECT_EQ(storage_->GetResidentGroupCount(), 0);
+    
+    // 다음 사용 시 같은 세션/시퀀스/현재 배치로 복원
+    for (size_t g = 0; g < group_keys.size(); ++g) {
+        for (int i = 15; i < 20; ++i) {
+            ASSERT_TRUE(storage_->Save(group_keys[g], group_keys[g] + "_" + std::to_string(i)));
+        }
+        EXPECT_EQ(storage_->GetSessionId(group_keys[g]), session_ids[g]);
+    }
+    EXPECT_EQ(storage_->GetResidentGroupCount(), 2);
+    
+    auto batches = storage_->LoadBatch(group_keys[0], 100);
+    ASSERT_EQ(batches.size(), 2);
+    EXPECT_EQ(batches[1].sequence_start, 10);
+    ASSERT_EQ(batches[1].data.size(), 10);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(batches[0].data[i], "idle_a_" + std::to_string(i));
+        EXPECT_EQ(batches[1].data[i], "idle_a_" + std::to_string(10 + i));
+    }
+    
+    // ACK/Load도 축출된 그룹을 복원
+    ASSERT_EQ(storage_->EvictIdleGroups(0), 2);
+    EXPECT_TRUE(storage_->AcknowledgeBatch(group_keys[0], batches[0].batch_id));
+    EXPECT_EQ(storage_->Load(group_keys[1]).size(), 20);
+    
+    // 재시작하면 축출 상태는 이어지지 않음
+    ASSERT_EQ(storage_->EvictIdleGroups(0), 2);
+    storage_->Shutdown();
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString());
+    ASSERT_TRUE(storage_->Initialize());
+    EXPECT_TRUE(storage_->GetSessionId(group_keys[0]).empty());
+    EXPECT_EQ(storage_->ListGroups().size(), 2);
+}
+
+TEST_F(GroupStorageTest, IdleGroupTimeoutEvictsInBackground) {
+    storage_->Shutdown();
+    StorageOptions options;
+    options.idle_group_timeout_ms = 50;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "timeout_group";
+    ASSERT_TRUE(storage_->Save(group_key, "before"));
+    
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (storage_->GetResidentGroupCount() != 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(storage_->GetResidentGroupCount(), 0);
+    
+    ASSERT_TRUE(storage_->Save(group_key, "after"));
+    auto data = storage_->Load(group_key);
+    ASSERT_EQ(data.size(), 2);
+    EXPECT_EQ(data[0], "before");
+    EXPECT_EQ(data[1], "after");
+}
+
+TEST_F(GroupStorageTest, ParallelLoadPreservesOrder) {
+    std::string group_key = "parallel_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(7);
+    
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data_" + std::to_string(i)));
+    }
+    
+    // ACK된 배치는 순차/병렬 모두에서 제외
+    auto batches = storage_->LoadBatch(group_key, 1);
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_TRUE(storage_->AcknowledgeBatch(group_key, batches[0].batch_id));
+    
+    auto sequential = storage_->Load(group_key, 1);
+    ASSERT_EQ(sequential.size(), 193);
+    EXPECT_EQ(sequential.front(), "data_7");
+    EXPECT_EQ(sequential.back(), "data_199");
+    
+    // 배치 수보다 많은 스레드도 허용
+    for (size_t threads : {2, 3, 8, 64}) {
+        EXPECT_EQ(storage_->Load(group_key, threads), sequential) << "threads=" << threads;
+    }
+}
+
+TEST_F(GroupStorageTest, AcknowledgeUpToWatermark) {
+    std::string group_key = "watermark_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(10);
+    
+    for (int i = 0; i < 35; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data_" + std::to_string(i)));
+    }
+    
+    // 아직 저장되지 않은 시퀀스는 ACK 불가
+    EXPECT_FALSE(storage_->AcknowledgeUpTo(group_key, 35));
+    EXPECT_FALSE(storage_->AcknowledgeUpTo("unknown_group", 0));
+    
+    // 두 배치 전체 + 세 번째 배치 일부를 한 번에 ACK
+    ASSERT_TRUE(storage_->AcknowledgeUpTo(group_key, 22));
+    auto data = storage_->Load(group_key);
+    ASSERT_EQ(data.size(), 12);
+    EXPECT_EQ(data.front(), "data_23");
+    EXPECT_EQ(data.back(), "data_34");
+    
+    // 워터마크 이하로는 되돌아가지 않음
+    EXPECT_TRUE(storage_->AcknowledgeUpTo(group_key, 5));
+    EXPECT_EQ(storage_->Load(group_key).size(), 12);
+    
+    // 경계 배치는 워터마크 다음부터 시작
+    auto batches = storage_->LoadBatch(group_key, 100);
+    ASSERT_EQ(batches.size(), 2);
+    EXPECT_EQ(batches[0].sequence_start, 23);
+    ASSERT_EQ(batches[0].data.size(), 7);
+    EXPECT_EQ(batches[0].data[0], "data_23");
+    EXPECT_EQ(batches[1].sequence_start, 30);
+    EXPECT_EQ(batches[1].data.size(), 5);
+    
+    // 열린 배치에 이어서 저장한 뒤 전체 ACK
+    for (int i = 35; i < 45; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data_" + std::to_string(i)));
+    }
+    ASSERT_TRUE(storage_->AcknowledgeUpTo(group_key, 44));
+    EXPECT_TRUE(storage_->Load(group_key).empty());
+    EXPECT_TRUE(storage_->LoadBatch(group_key, 100).empty());
+    
+    // 완전히 ACK된 배치는 개별 ACK 대상이 아님
+    EXPECT_FALSE(storage_->AcknowledgeBatch(group_key, batches[0].batch_id));
+    
+    ASSERT_TRUE(storage_->Save(group_key, "data_45"));
+    data = storage_->Load(group_key);
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(data[0], "data_45");
+}
+
+TEST_F(GroupStorageTest, AcknowledgeUpToAfterResave) {
+    std::string group_key = "watermark_resave_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(10);
+    
+    for (int i = 0; i < 15; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data_" + std::to_string(i)));
+    }
+    
+    // 첫 배치를 재저장하면 ULID 순서상 뒤에 오지만 열린 배치보다 앞선 시퀀스 범위를 가짐
+    auto batches = storage_->LoadBatch(group_key, 1);
+    ASSERT_EQ(batches.size(), 1);
+    std::vector<std::string> remaining = {"resaved_0", "resaved_1", "resaved_2"};
+    ASSERT_TRUE(storage_->ResaveBatch(group_key, batches[0].batch_id, remaining));
+    
+    // 재저장 배치가 예약한 범위(15~17) 다음부터 열린 배치에 이어서 저장
+    ASSERT_TRUE(storage_->Save(group_key, "data_18"));
+    ASSERT_TRUE(storage_->Save(group_key, "data_19"));
+    
+    // 워터마크가 열린 배치와 재저장 배치에 모두 걸침
+    ASSERT_TRUE(storage_->AcknowledgeUpTo(group_key, 16));
+    auto data = storage_->Load(group_key);
+    std::sort(data.begin(), data.end());
+    ASSERT_EQ(data.size(), 3);
+    EXPECT_EQ(data[0], "data_18");
+    EXPECT_EQ(data[1], "data_19");
+    EXPECT_EQ(data[2], "resaved_2");
+    
+    for (const auto& batch : storage_->LoadBatch(group_key, 100)) {
+        EXPECT_GT(batch.sequence_start, 16);
+    }
+    
+    // 할당된 시퀀스 전체를 ACK하면 재저장 배치도 남지 않음
+    ASSERT_TRUE(storage_->AcknowledgeUpTo(group_key, 19));
+    EXPECT_TRUE(storage_->Load(group_key).empty());
+    EXPECT_TRUE(storage_->LoadBatch(group_key, 100).empty());
+}
+
+TEST_F(GroupStorageTest, PayloadDeduplication) {
+    // 중복 제거 활성화된 저장소로 다시 열기
+    storage_->Shutdown();
+    StorageOptions options;
+    options.dedup_min_size = 64;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string payload(256, 'P');
+    std::string small_payload = "small";
+    
+    // 같은 이벤트를 여러 그룹에 팬아웃
+    std::vector<std::pair<std::string, std::string>> entries = {
+        {"all_logs", payload},
+        {"service_a", payload},
+        {"errors", payload},
+        {"all_logs", small_payload},
+    };
+    ASSERT_TRUE(storage_->SaveMulti(entries));
+    ASSERT_TRUE(storage_->Save("all_logs", payload));
+    
+    auto stats = storage_->GetDedupStats();
+    EXPECT_EQ(stats.payload_bytes, payload.size() * 4);
+    EXPECT_EQ(stats.deduplicated_count, 3);
+    EXPECT_EQ(stats.stored_bytes, payload.size());      // 본문은 한 번만 저장
+    
+    // 로드 시 참조가 실제 페이로드로 변환됨
+    auto all_logs = storage_->Load("all_logs");
+    ASSERT_EQ(all_logs.size(), 3);
+    EXPECT_EQ(all_logs[0], payload);
+    EXPECT_EQ(all_logs[1], small_payload);
+    EXPECT_EQ(all_logs[2], payload);
+    
+    auto errors = storage_->LoadBatch("errors", 100);
+    ASSERT_EQ(errors.size(), 1);
+    EXPECT_EQ(errors[0].data[0], payload);
+    
+    // 한 그룹의 ACK 후에도 다른 그룹은 페이로드 참조 가능
+    EXPECT_TRUE(storage_->AcknowledgeBatch("errors", errors[0].batch_id));
+    auto service_a = storage_->Load("service_a");
+    ASSERT_EQ(service_a.size(), 1);
+    EXPECT_EQ(service_a[0], payload);
+}
+
+TEST_F(GroupStorageTest, DropGroupReleasesDeduplicatedPayloads) {
+    storage_->Shutdown();
+    StorageOptions options;
+    options.dedup_min_size = 64;
+    options.enable_checksums = true;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string payload(256, 'P');
+    std::vector<std::pair<std::string, std::string>> entries = {
+        {"drop_a", payload},
+        {"drop_b", payload},
+    };
+    ASSERT_TRUE(storage_->SaveMulti(entries));
+    ASSERT_TRUE(storage_->Save("drop_a", payload));
+    
+    // 한 그룹을 삭제해도 다른 그룹은 페이로드 참조 가능
+    ASSERT_TRUE(storage_->DropGroup("drop_a"));
+    auto data = storage_->Load("drop_b");
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(data[0], payload);
+    
+    // 마지막 참조 그룹까지 삭제하면 본문과 참조 카운트 키가 회수됨
+    ASSERT_TRUE(storage_->DropGroup("drop_b"));
+    storage_->Shutdown();
+    
+    auto raw = CreateStorage(StorageOptions());
+    ASSERT_TRUE(raw->Initialize(test_dir_guard_->GetPathString()));
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    raw->ScanPrefix("__durastash__:blob", keys, values);
+    EXPECT_TRUE(keys.empty());
+    raw->Shutdown();
+}
+
+TEST_F(GroupStorageTest, DeduplicationKeepsReferenceLikePayloads) {
+    // 참조 값과 같은 형식의 일반 페이로드
+    std::string lookalike = std::string("\0DSREF:", 7) + std::string(32, '0');
+    std::vector<std::string> payloads = {lookalike, std::string("\0\0x", 3), std::string(1, '\0'), "plain"};
+    
+    // 중복 제거 비활성: 저장 값을 변환하지 않음
+    std::string group_key = "lookalike_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    for (const auto& payload : payloads) {
+        ASSERT_TRUE(storage_->Save(group_key, payload));
+    }
+    EXPECT_EQ(storage_->Load(group_key), payloads);
+    
+    // 중복 제거 활성 (+ 체크섬): NUL 바이트로 시작하는 일반 페이로드는 이스케이프되어 그대로 반환
+    storage_->Shutdown();
+    StorageOptions options;
+    options.dedup_min_size = 64;
+    options.enable_checksums = true;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    auto consumer = storage_->CreateConsumer(group_key);
+    ASSERT_NE(consumer, nullptr);
+    for (const auto& payload : payloads) {
+        ASSERT_TRUE(storage_->Save(group_key, payload));
+    }
+    EXPECT_EQ(storage_->Load(group_key), payloads);
+    EXPECT_EQ(consumer->Poll(), payloads);
+    
+    auto batches = storage_->LoadBatch(group_key, 10);
+    ASSERT_EQ(batches.size(), 1);
+    EXPECT_EQ(batches[0].data, payloads);
+    EXPECT_TRUE(storage_->AcknowledgeBatch(group_key, batches[0].batch_id));
+}
+
+TEST_F(GroupStorageTest, BlobFilesRoundTrip) {
+    // BlobDB 활성화된 저장소로 다시 열기
+    storage_->Shutdown();
+    StorageOptions options;
+    options.enable_blob_files = true;
+    options.min_blob_size = 1024;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    
+    std::string large_payload(8192, 'B');
+    ASSERT_TRUE(storage_->Save(group_key, large_payload));
+    ASSERT_TRUE(storage_->Save(group_key, "small"));
+    ASSERT_TRUE(storage_->Flush());
+    
+    // 플러시 후 큰 값은 blob 파일에 저장됨
+    StorageStats stats = storage_->GetStorageStats();
+    EXPECT_GT(stats.blob_files_size, 0);
+    
+    auto batches = storage_->LoadBatch(group_key, 100);
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(batches[0].data.size(), 2);
+    EXPECT_EQ(batches[0].data[0], large_payload);
+    EXPECT_EQ(batches[0].data[1], "small");
+}
+
+TEST_F(GroupStorageTest, SharedMemoryBudget) {
+    auto budget = MemoryBudget::Create(32 * 1024 * 1024, 0.5);
+    EXPECT_EQ(budget->GetCapacity(), 32 * 1024 * 1024);
+    EXPECT_EQ(budget->GetWriteBufferLimit(), 16 * 1024 * 1024);
+    
+    StorageOptions options;
+    options.memory_budget = budget;
+    
+    TestDirectoryGuard first_dir("budget_db_a");
+    TestDirectoryGuard second_dir("budget_db_b");
+    GroupStorage first(first_dir.GetPathString(), options);
+    GroupStorage second(second_dir.GetPathString(), options);
+    ASSERT_TRUE(first.Initialize());
+    ASSERT_TRUE(second.Initialize());
+    
+    std::string group_key = "test_group";
+    ASSERT_TRUE(first.InitializeSession(group_key));
+    ASSERT_TRUE(second.InitializeSession(group_key));
+    
+    std::string payload(4096, 'M');
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(first.Save(group_key, payload));
+        ASSERT_TRUE(second.Save(group_key, payload));
+    }
+    
+    // 인스턴스별 메모리 테이블 사용량이 보고되고, 공유 예산에 합산됨
+    StorageStats first_stats = first.GetStorageStats();
+    StorageStats second_stats = second.GetStorageStats();
+    EXPECT_GT(first_stats.memtable_bytes, 0);
+    EXPECT_GT(second_stats.memtable_bytes, 0);
+    EXPECT_GE(budget->GetWriteBufferUsage(), first_stats.memtable_bytes);
+    EXPECT_LE(budget->GetUsage(), budget->GetCapacity());
+    
+    EXPECT_EQ(first.Load(group_key).size(), 100);
+    EXPECT_EQ(second.Load(group_key).size(), 100);
+    
+    first.Shutdown();
+    second.Shutdown();
+}
+
+TEST_F(GroupStorageTest, RateLimitedBackgroundIo) {
+    // 백그라운드 I/O 속도 제한 활성화된 저장소로 다시 열기
+    storage_->Shutdown();
+    StorageOptions options;
+    options.rate_limit_bytes_per_sec = 16 * 1024 * 1024;
+    options.rate_limit_reads = true;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    
+    std::string payload(4096, 'R');
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, payload));
+    }
+    ASSERT_TRUE(storage_->Flush());
+    
+    // 플러시 기록이 속도 제한기를 통과하며, 포그라운드 읽기는 정상 동작
+    StorageStats stats = storage_->GetStorageStats();
+    EXPECT_GT(stats.rate_limit_bytes_per_sec, 0);
+    EXPECT_LE(stats.rate_limit_bytes_per_sec, options.rate_limit_bytes_per_sec);
+    EXPECT_GT(stats.rate_limited_bytes, 0);
+    EXPECT_EQ(storage_->Load(group_key).size(), 100);
+}
+
+TEST_F(GroupStorageTest, LazyRecoveryOpen) {
+    ASSERT_TRUE(storage_->InitializeSession("group_a"));
+    ASSERT_TRUE(storage_->InitializeSession("group_b"));
+    ASSERT_TRUE(storage_->Save("group_a", "data"));
+    storage_->Shutdown();
+    
+    // 오픈 시간 옵션 + 지연 복구로 다시 열기
+    StorageOptions options;
+    options.lazy_recovery = true;
+    options.max_open_files = 64;
+    options.skip_stats_update_on_db_open = true;
+    options.skip_checking_sst_file_sizes_on_db_open = true;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    // 복구 완료 전에도 Save 처리 가능
+    ASSERT_TRUE(storage_->InitializeSession("group_c"));
+    ASSERT_TRUE(storage_->Save("group_c", "fresh"));
+    
+    // ListGroups는 저장소의 레지스트리에서 기존 그룹과 새 그룹을 모두 반환
+    auto groups = storage_->ListGroups();
+    ASSERT_EQ(groups.size(), 3);
+    EXPECT_EQ(groups[0], "group_a");
+    EXPECT_EQ(groups[1], "group_b");
+    EXPECT_EQ(groups[2], "group_c");
+    
+    storage_->WaitForRecovery();
+    EXPECT_EQ(storage_->Load("group_c").size(), 1);
+}
+
+TEST_F(GroupStorageTest, CheckpointAndBackup) {
+    ASSERT_TRUE(storage_->InitializeSession("group_a"));
+    ASSERT_TRUE(storage_->Save("group_a", "data"));
+    
+    TestDirectoryGuard checkpoint_parent("checkpoint_db");
+    std::string checkpoint_dir = (checkpoint_parent.GetPath() / "checkpoint").string();
+    ASSERT_TRUE(storage_->CreateCheckpoint(checkpoint_dir));
+    
+    TestDirectoryGuard backup_dir("backup_db");
+    BackupInfo first_backup;
+    ASSERT_TRUE(storage_->CreateBackup(backup_dir.GetPathString(), &first_backup));
+    EXPECT_GT(first_backup.backup_id, 0);
+    
+    // 두 번째 백업은 증분으로 누적됨
+    ASSERT_TRUE(storage_->InitializeSession("group_b"));
+    ASSERT_TRUE(storage_->CreateBackup(backup_dir.GetPathString()));
+    auto backups = ListBackups(backup_dir.GetPathString());
+    ASSERT_EQ(backups.size(), 2);
+    EXPECT_EQ(backups[0].backup_id, first_backup.backup_id);
+    
+    // 체크포인트는 생성 시점의 그룹만 포함
+    {
+        GroupStorage checkpoint(checkpoint_dir);
+        ASSERT_TRUE(checkpoint.Initialize());
+        auto groups = checkpoint.ListGroups();
+        ASSERT_EQ(groups.size(), 1);
+        EXPECT_EQ(groups[0], "group_a");
+        checkpoint.Shutdown();
+    }
+    
+    // 최신 백업으로 복원
+    TestDirectoryGuard restore_dir("restore_db");
+    ASSERT_TRUE(RestoreLatestBackup(backup_dir.GetPathString(), restore_dir.GetPathString()));
+    {
+        GroupStorage restored(restore_dir.GetPathString());
+        ASSERT_TRUE(restored.Initialize());
+        EXPECT_EQ(restored.ListGroups().size(), 2);
+        restored.Shutdown();
+    }
+    
+    ASSERT_TRUE(PurgeOldBackups(backup_dir.GetPathString(), 1));
+    EXPECT_EQ(ListBackups(backup_dir.GetPathString()).size(), 1);
+}
+
+TEST_F(GroupStorageTest, BackupConcurrentWithShutdown) {
+    std::string group_key = "backup_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    std::vector<std::pair<std::string, std::string>> entries;
+    for (int i = 0; i < 1000; ++i) {
+        entries.push_back({group_key, std::string(1024, static_cast<char>('a' + i % 26))});
+    }
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(storage_->SaveMulti(entries));
+    }
+    ASSERT_TRUE(storage_->Flush());
+    
+    // 백업 도중 Shutdown이 호출되어도 저장소는 백업이 끝난 뒤에 닫힘
+    TestDirectoryGuard backup_dir("backup_shutdown_db");
+    std::atomic<bool> backup_started{false};
+    bool backed_up = false;
+    std::thread backup_thread([&]() {
+        backup_started = true;
+        backed_up = storage_->CreateBackup(backup_dir.GetPathString());
+    });
+    while (!backup_started) {
+        std::this_thread::yield();
+    }
+    storage_->Shutdown();
+    backup_thread.join();
+    
+    // Shutdown 이후의 백업은 거부
+    EXPECT_FALSE(storage_->CreateBackup(backup_dir.GetPathString()));
+    
+    // 완료된 백업은 복원 가능
+    if (backed_up) {
+        TestDirectoryGuard restore_dir("restore_shutdown_db");
+        ASSERT_TRUE(RestoreLatestBackup(backup_dir.GetPathString(), restore_dir.GetPathString()));
+        GroupStorage restored(restore_dir.GetPathString());
+        ASSERT_TRUE(restored.Initialize());
+        auto groups = restored.ListGroups();
+        ASSERT_EQ(groups.size(), 1);
+        EXPECT_EQ(groups[0], group_key);
+        restored.Shutdown();
+    }
+}
+
+TEST_F(GroupStorageTest, ReadaheadAsyncIoLoad) {
+    // 범위 읽기 readahead/비동기 I/O 활성화된 저장소로 다시 열기
+    storage_->Shutdown();
+    StorageOptions options;
+    options.readahead_size = 1024 * 1024;
+    options.adaptive_readahead = true;
+    options.async_io = true;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(100);
+    
+    for (int i = 0; i < 250; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data" + std::to_string(i)));
+    }
+    ASSERT_TRUE(storage_->Flush());
+    
+    auto values = storage_->Load(group_key);
+    ASSERT_EQ(values.size(), 250);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], "data" + std::to_string(i));
+    }
+    
+    auto batches = storage_->LoadBatch(group_key, 10);
+    ASSERT_EQ(batches.size(), 3);
+    EXPECT_EQ(batches[0].data.size(), 100);
+    EXPECT_EQ(batches[1].data.size(), 100);
+    EXPECT_EQ(batches[2].data.size(), 50);
+    EXPECT_EQ(batches[2].data.back(), "data249");
+}
+
+TEST_F(GroupStorageTest, ExportImportGroup) {
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(100);
+    for (int i = 0; i < 250; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data" + std::to_string(i)));
+    }
+    
+    TestDirectoryGuard export_dir("export_files");
+    std::string export_path = (export_dir.GetPath() / "group.sst").string();
+    ASSERT_TRUE(storage_->ExportGroup(group_key, export_path));
+    EXPECT_FALSE(storage_->ExportGroup("unknown_group", export_path + ".none"));
+    
+    // 다른 저장소의 기존 데이터 뒤에 가져오기
+    TestDirectoryGuard target_dir("import_db");
+    GroupStorage target(target_dir.GetPathString());
+    ASSERT_TRUE(target.Initialize());
+    ASSERT_TRUE(target.InitializeSession("imported"));
+    target.SetBatchSize(100);
+    ASSERT_TRUE(target.Save("imported", "existing"));
+    
+    ASSERT_TRUE(target.ImportGroup(export_path, "imported"));
+    EXPECT_FALSE(std::filesystem::exists(export_path + ".import"));
+    ASSERT_TRUE(target.Save("imported", "after"));
+    
+    auto values = target.Load("imported");
+    ASSERT_EQ(values.size(), 252);
+    EXPECT_EQ(values.front(), "existing");
+    for (int i = 0; i < 250; ++i) {
+        EXPECT_EQ(values[i + 1], "data" + std::to_string(i));
+    }
+    EXPECT_EQ(values.back(), "after");
+    
+    // 가져온 배치는 PENDING 상태로 LoadBatch/ACK 가능
+    auto batches = target.LoadBatch("imported", 10);
+    ASSERT_EQ(batches.size(), 5);
+    EXPECT_EQ(batches[1].data.size(), 100);
+    EXPECT_EQ(batches[1].data.front(), "data0");
+    for (const auto& batch : batches) {
+        EXPECT_TRUE(target.AcknowledgeBatch("imported", batch.batch_id));
+    }
+    EXPECT_TRUE(target.Load("imported").empty());
+    
+    // 원본 그룹 키로 가져오기
+    ASSERT_TRUE(target.InitializeSession(group_key));
+    ASSERT_TRUE(target.ImportGroup(export_path));
+    EXPECT_EQ(target.Load(group_key).size(), 250);
+    
+    // 가져오기에 실패해도 재작성 파일은 남지 않음
+    EXPECT_FALSE(target.ImportGroup(export_path, "__durastash__:imported"));
+    EXPECT_FALSE(std::filesystem::exists(export_path + ".import"));
+    target.Shutdown();
+}
+
+TEST_F(GroupStorageTest, ColdTierSpill) {
+    // 콜드 티어 활성화된 저장소로 다시 열기 (경과 시간 조건 없음)
+    TestDirectoryGuard cold_dir("cold_tier");
+    storage_->Shutdown();
+    StorageOptions options;
+    options.cold_tier_path = cold_dir.GetPathString();
+    options.cold_tier_min_age_ms = 0;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(100);
+    for (int i = 0; i < 250; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data" + std::to_string(i)));
+    }
+    
+    // 닫힌 배치 2개만 이동 (마지막 배치는 아직 Save 대상)
+    EXPECT_EQ(storage_->SpillColdBatches(group_key), 2);
+    EXPECT_EQ(storage_->SpillColdBatches(group_key), 0);
+    auto segment_count = [&]() {
+        return std::distance(std::filesystem::directory_iterator(cold_dir.GetPath()),
+                             std::filesystem::directory_iterator());
+    };
+    EXPECT_EQ(segment_count(), 1);
+    
+    auto values = storage_->Load(group_key);
+    ASSERT_EQ(values.size(), 250);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], "data" + std::to_string(i));
+    }
+    
+    auto batches = storage_->LoadBatch(group_key, 10);
+    ASSERT_EQ(batches.size(), 3);
+    EXPECT_EQ(batches[0].data.size(), 100);
+    EXPECT_EQ(batches[0].data.front(), "data0");
+    EXPECT_EQ(batches[1].data.back(), "data199");
+    EXPECT_EQ(batches[2].data.size(), 50);
+    
+    // 세그먼트의 모든 배치가 ACK되면 파일 삭제
+    ASSERT_TRUE(storage_->AcknowledgeBatch(group_key, batches[0].batch_id));
+    EXPECT_EQ(segment_count(), 1);
+    ASSERT_TRUE(storage_->AcknowledgeBatch(group_key, batches[1].batch_id));
+    EXPECT_EQ(segment_count(), 0);
+    ASSERT_TRUE(storage_->AcknowledgeBatch(group_key, batches[2].batch_id));
+    EXPECT_TRUE(storage_->Load(group_key).empty());
+    
+    // DropGroup은 남은 세그먼트도 삭제
+    ASSERT_TRUE(storage_->InitializeSession("other_group"));
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(storage_->Save("other_group", "more" + std::to_string(i)));
+    }
+    EXPECT_EQ(storage_->SpillColdBatches("other_group"), 1);
+    EXPECT_EQ(segment_count(), 1);
+    ASSERT_TRUE(storage_->DropGroup("other_group"));
+    EXPECT_EQ(segment_count(), 0);
+    
+    // 세그먼트 파일이 사라지면 빈 배치를 반환하지 않고 손상으로 보고 (배치는 Pending 유지)
+    ASSERT_TRUE(storage_->InitializeSession("missing_group"));
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(storage_->Save("missing_group", "lost" + std::to_string(i)));
+    }
+    EXPECT_EQ(storage_->SpillColdBatches("missing_group"), 1);
+    for (const auto& entry : std::filesystem::directory_iterator(cold_dir.GetPath())) {
+        std::filesystem::remove(entry.path());
+    }
+    EXPECT_THROW(storage_->LoadBatch("missing_group", 10), CorruptedBatchException);
+    EXPECT_THROW(storage_->LoadBatch("missing_group", 10), CorruptedBatchException);
+    EXPECT_THROW(storage_->Load("missing_group"), CorruptedBatchException);
+    EXPECT_TRUE(storage_->DropGroup("missing_group"));
+}
+
+TEST_F(GroupStorageTest, ColdTierExportImport) {
+    TestDirectoryGuard cold_dir("cold_tier");
+    storage_->Shutdown();
+    StorageOptions options;
+    options.cold_tier_path = cold_dir.GetPathString();
+    options.cold_tier_min_age_ms = 0;
+    options.enable_checksums = true;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(100);
+    for (int i = 0; i < 250; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data" + std::to_string(i)));
+    }
+    ASSERT_EQ(storage_->SpillColdBatches(group_key), 2);
+    
+    // 이동된 배치도 세그먼트에서 읽어 내보냄
+    TestDirectoryGuard export_dir("export_files");
+    std::string export_path = (export_dir.GetPath() / "group.sst").string();
+    ASSERT_TRUE(storage_->ExportGroup(group_key, export_path));
+    
+    TestDirectoryGuard target_dir("import_db");
+    GroupStorage target(target_dir.GetPathString());
+    ASSERT_TRUE(target.Initialize());
+    ASSERT_TRUE(target.InitializeSession(group_key));
+    ASSERT_TRUE(target.ImportGroup(export_path));
+    
+    auto values = target.Load(group_key);
+    ASSERT_EQ(values.size(), 250);
+    for (int i = 0; i < 250; ++i) {
+        EXPECT_EQ(values[i], "data" + std::to_string(i));
+    }
+    auto batches = target.LoadBatch(group_key, 10);
+    ASSERT_EQ(batches.size(), 3);
+    EXPECT_EQ(batches[0].data.size(), 100);
+    EXPECT_EQ(batches[1].data.back(), "data199");
+    EXPECT_EQ(batches[2].data.size(), 50);
+    target.Shutdown();
+    
+    // 세그먼트를 읽을 수 없으면 일부 배치가 빠진 파일을 만들지 않음
+    for (const auto& entry : std::filesystem::directory_iterator(cold_dir.GetPath())) {
+        std::filesystem::remove(entry.path());
+    }
+    EXPECT_FALSE(storage_->ExportGroup(group_key, export_path + ".missing"));
+}
+
+TEST_F(GroupStorageTest, ReplaySegmentSnapshot) {
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(100);
+    for (int i = 0; i < 250; ++i) {
+        ASSERT_TRUE(storage_->Save(group_key, "data" + std::to_string(i)));
+    }
+    
+    TestDirectoryGuard replay_dir("replay_files");
+    std::string path = (replay_dir.GetPath() / "group.replay").string();
+    ASSERT_TRUE(storage_->SnapshotGroup(group_key, path));
+    EXPECT_FALSE(storage_->SnapshotGroup("unknown_group", path + ".none"));
+    
+    // 스냅샷은 배치 상태를 바꾸지 않음
+    EXPECT_EQ(storage_->LoadBatch(group_key, 10).size(), 3);
+    
+    // 같은 파일을 여러 번 리플레이
+    auto expected = storage_->Load(group_key);
+    for (int pass = 0; pass < 2; ++pass) {
+        auto cursor = OpenReplaySegment(path);
+        ASSERT_NE(cursor, nullptr);
+        std::vector<std::string> values;
+        for (cursor->Seek(""); cursor->Valid(); cursor->Next()) {
+            values.emplace_back(cursor->Value());
+        }
+        EXPECT_EQ(values, expected);
+    }
+    
+    // 라이브 그룹과 같은 커서 인터페이스이므로 StreamConsumer로도 읽을 수 있음
+    std::string data_prefix = group_key + ":" + storage_->GetSessionId(group_key) + ":";
+    StreamConsumer consumer(OpenReplaySegment(path), data_prefix, nullptr);
+    EXPECT_EQ(consumer.Poll(100).size(), 100);
+    EXPECT_EQ(consumer.Poll().size(), 150);
+    
+    // 손상된 파일은 체크섬 검증에서 거부
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(64);
+        file.put('#');
+    }
+    EXPECT_EQ(OpenReplaySegment(path), nullptr);
+}
+
+TEST_F(GroupStorageTest, RecordChecksums) {
+    // 레코드 체크섬 + 중복 제거 활성화된 저장소로 다시 열기
+    storage_->Shutdown();
+    StorageOptions options;
+    options.enable_checksums = true;
+    options.dedup_min_size = 64;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "test_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(100);
+    auto consumer = storage_->CreateConsumer(group_key);
+    ASSERT_NE(consumer, nullptr);
+    
+    std::vector<std::string> expected;
+    for (int i = 0; i < 150; ++i) {
+        // 짝수는 중복 제거 대상 (같은 본문 참조)
+        expected.push_back(i % 2 == 0 ? std::string(128, 'D') : "data" + std::to_string(i));
+        ASSERT_TRUE(storage_->Save(group_key, expected.back()));
+    }
+    
+    EXPECT_EQ(storage_->Load(group_key), expected);
+    EXPECT_EQ(consumer->Poll(), expected);
+    
+    auto batches = storage_->LoadBatch(group_key, 10);
+    ASSERT_EQ(batches.size(), 2);
+    EXPECT_EQ(batches[0].data.front(), expected.front());
+    for (const auto& batch : batches) {
+        EXPECT_TRUE(storage_->AcknowledgeBatch(group_key, batch.batch_id));
+    }
+    EXPECT_TRUE(storage_->Load(group_key).empty());
+    
+    // 내보낸 파일의 페이로드 1바이트를 변조한 뒤 가져오면 로드 시 검출
+    std::string source_group = "source_group";
+    ASSERT_TRUE(storage_->InitializeSession(source_group));
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(storage_->Save(source_group, "record" + std::to_string(i)));
+    }
+    TestDirectoryGuard export_dir("checksum_export");
+    std::string export_path = (export_dir.GetPath() / "group.sst").string();
+    std::string tampered_path = (export_dir.GetPath() / "tampered.sst").string();
+    ASSERT_TRUE(storage_->ExportGroup(source_group, export_path));
+    {
+        auto raw = CreateStorage(StorageOptions());
+        auto reader = raw->OpenExternalFile(export_path);
+        auto writer = raw->NewExternalFileWriter();
+        ASSERT_NE(reader, nullptr);
+        ASSERT_TRUE(writer->Open(tampered_path));
+        bool tampered = false;
+        for (reader->Seek(""); reader->Valid(); reader->Next()) {
+            std::string key(reader->Key());
+            std::string value(reader->Value());
+            if (!tampered && key.find(":batch:") == std::string::npos) {
+                value[0] ^= 1;
+                tampered = true;
+            }
+            ASSERT_TRUE(writer->Put(key, value));
+        }
+        ASSERT_TRUE(writer->Finish());
+    }
+    
+    ASSERT_TRUE(storage_->ImportGroup(tampered_path, "tampered_group"));
+    EXPECT_THROW(storage_->Load("tampered_group"), CorruptedBatchException);
+    ASSERT_TRUE(storage_->ImportGroup(export_path, "intact_group"));
+    EXPECT_EQ(storage_->Load("intact_group").size(), 10);
+}
+
+TEST_F(GroupStorageTest, LoadBatchCorruptionKeepsBatchPending) {
+    storage_->Shutdown();
+    StorageOptions options;
+    options.enable_checksums = true;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    storage_->SetBatchSize(5);
+    
+    std::string source_group = "source_group";
+    ASSERT_TRUE(storage_->InitializeSession(source_group));
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(storage_->Save(source_group, "record" + std::to_string(i)));
+    }
+    
+    // 두 번째 배치의 마지막 레코드만 변조하여 가져오기
+    TestDirectoryGuard export_dir("load_batch_corruption");
+    std::string export_path = (export_dir.GetPath() / "group.sst").string();
+    std::string tampered_path = (export_dir.GetPath() / "tampered.sst").string();
+    ASSERT_TRUE(storage_->ExportGroup(source_group, export_path));
+    {
+        auto raw = CreateStorage(StorageOptions());
+        auto reader = raw->OpenExternalFile(export_path);
+        ASSERT_NE(reader, nullptr);
+        std::vector<std::pair<std::string, std::string>> entries;
+        size_t last_record = 0;
+        for (reader->Seek(""); reader->Valid(); reader->Next()) {
+            entries.emplace_back(std::string(reader->Key()), std::string(reader->Value()));
+            if (entries.back().first.find(":batch:") == std::string::npos) {
+                last_record = entries.size() - 1;
+            }
+        }
+        entries[last_record].second[0] ^= 1;
+        
+        auto writer = raw->NewExternalFileWriter();
+        ASSERT_TRUE(writer->Open(tampered_path));
+        for (const auto& [key, value] : entries) {
+            ASSERT_TRUE(writer->Put(key, value));
+        }
+        ASSERT_TRUE(writer->Finish());
+    }
+    ASSERT_TRUE(storage_->ImportGroup(tampered_path, "tampered_group"));
+    
+    // 온전한 첫 배치만 반환되고 손상된 배치는 Loaded로 바뀌지 않음
+    auto batches = storage_->LoadBatch("tampered_group", 10);
+    ASSERT_EQ(batches.size(), 1);
+    EXPECT_EQ(batches[0].data.front(), "record0");
+    
+    // 손상된 배치는 다음 호출마다 다시 보고됨
+    EXPECT_THROW(storage_->LoadBatch("tampered_group", 10), CorruptedBatchException);
+    EXPECT_THROW(storage_->LoadBatch("tampered_group", 10), CorruptedBatchException);
+    ArenaBatchLoadResult arena_result;
+    EXPECT_THROW(storage_->LoadBatch("tampered_group", arena_result), CorruptedBatchException);
+    EXPECT_THROW(storage_->LoadBatch("tampered_group", 10), CorruptedBatchException);
+    
+    EXPECT_TRUE(storage_->AcknowledgeBatch("tampered_group", batches[0].batch_id));
+}
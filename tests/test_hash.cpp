@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include "durastash/hash.h"
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace durastash;
+
+// Windows에서 콘솔 출력 인코딩을 UTF-8로 설정
+namespace {
+    struct ConsoleEncodingSetter {
+        ConsoleEncodingSetter() {
+#ifdef _WIN32
+            SetConsoleOutputCP(65001);
+            SetConsoleCP(65001);
+#endif
+        }
+    };
+    ConsoleEncodingSetter g_console_encoding_setter;
+}
+
+TEST(HashTest, XXH64KnownVectors) {
+    // xxHash 레퍼런스 구현과 동일한 결과
+    EXPECT_EQ(Hash::XXH64(""), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(Hash::XXH64("abc"), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(Hash::XXH64("Nobody inspects the spammish repetition"), 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST(HashTest, XXH64LongInput) {
+    // 32바이트 이상 입력 (스트라이프 경로)
+    std::string data(100, '\0');
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i);
+    }
+    EXPECT_EQ(Hash::XXH64(data), 0x6AC1E58032166597ULL);
+}
+
+TEST(HashTest, SeedChangesHash) {
+    EXPECT_NE(Hash::XXH64("payload", 0), Hash::XXH64("payload", 1));
+    EXPECT_EQ(Hash::XXH64("payload", 7), Hash::XXH64("payload", 7));
+}
+
+TEST(HashTest, ToHex) {
+    EXPECT_EQ(Hash::ToHex(0), "0000000000000000");
+    EXPECT_EQ(Hash::ToHex(0xEF46DB3751D8E999ULL), "ef46db3751d8e999");
+    EXPECT_EQ(Hash::ToHex(0xFFFFFFFFFFFFFFFFULL).size(), Hash::HEX64_LENGTH);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "durastash/key_format.h"
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <random>
+#include <limits>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace durastash;
+
+// Windows에서 콘솔 출력 인코딩을 UTF-8로 설정
+namespace {
+    struct ConsoleEncodingSetter {
+        ConsoleEncodingSetter() {
+#ifdef _WIN32
+            SetConsoleOutputCP(65001);
+            SetConsoleCP(65001);
+#endif
+        }
+    };
+    ConsoleEncodingSetter g_console_encoding_setter;
+
+    std::string FormatWithStream(int64_t value) {
+        std::ostringstream oss;
+        oss << std::setfill('0') << std::setw(20) << value;
+        return oss.str();
+    }
+}
+
+TEST(KeyFormatTest, FormatKnownValues) {
+    std::string key;
+    KeyFormat::AppendSequence(key, 0);
+    EXPECT_EQ(key, "00000000000000000000");
+
+    key = "g:s:b:";
+    KeyFormat::AppendSequence(key, 42);
+    EXPECT_EQ(key, "g:s:b:00000000000000000042");
+
+    key.clear();
+    KeyFormat::AppendSequence(key, std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(key, "09223372036854775807");
+}
+
+TEST(KeyFormatTest, MatchesStreamFormattingAndRoundTrips) {
+    std::mt19937_64 rng(12345);
+    for (int i = 0; i < 100000; ++i) {
+        // 자릿수가 고르게 분포하도록 시프트 양도 무작위
+        int64_t value = static_cast<int64_t>((rng() >> (rng() % 64)) & 0x7FFFFFFFFFFFFFFFULL);
+        char digits[KeyFormat::SEQUENCE_DIGITS];
+        KeyFormat::FormatSequence(digits, value);
+        std::string formatted(digits, sizeof(digits));
+        ASSERT_EQ(formatted, FormatWithStream(value));
+
+        int64_t parsed = -1;
+        ASSERT_TRUE(KeyFormat::ParseSequence(formatted, parsed));
+        ASSERT_EQ(parsed, value);
+    }
+}
+
+TEST(KeyFormatTest, ParseRejectsInvalidInput) {
+    int64_t value = 0;
+    EXPECT_FALSE(KeyFormat::ParseSequence("", value));
+    EXPECT_FALSE(KeyFormat::ParseSequence("0000000000000000001", value));    // 19자리
+    EXPECT_FALSE(KeyFormat::ParseSequence("000000000000000000001", value));  // 21자리
+    EXPECT_FALSE(KeyFormat::ParseSequence("0000000000000000000a", value));
+    EXPECT_FALSE(KeyFormat::ParseSequence("00000000000/00000000", value));
+    EXPECT_FALSE(KeyFormat::ParseSequence("000:0000000000000000", value));
+    EXPECT_FALSE(KeyFormat::ParseSequence("0000000000000000000-", value));
+
+    // int64 범위 초과
+    EXPECT_FALSE(KeyFormat::ParseSequence("09223372036854775808", value));
+    EXPECT_FALSE(KeyFormat::ParseSequence("99999999999999999999", value));
+    EXPECT_TRUE(KeyFormat::ParseSequence("09223372036854775807", value));
+    EXPECT_EQ(value, std::numeric_limits<int64_t>::max());
+}
+
+TEST(KeyFormatTest, ParseKeySequence) {
+    int64_t value = 0;
+    EXPECT_TRUE(KeyFormat::ParseKeySequence("group:01ARZ3NDEKTSV4RRFFQ69G5FAV:01ARZ3NDEKTSV4RRFFQ69G5FAW:00000000000000001234", value));
+    EXPECT_EQ(value, 1234);
+    EXPECT_FALSE(KeyFormat::ParseKeySequence("short:1234", value));
+}
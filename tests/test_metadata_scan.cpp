@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "durastash/metadata_scan.h"
+#include <string>
+#include <random>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace durastash;
+
+// Windows에서 콘솔 출력 인코딩을 UTF-8로 설정
+namespace {
+    struct ConsoleEncodingSetter {
+        ConsoleEncodingSetter() {
+#ifdef _WIN32
+            SetConsoleOutputCP(65001);
+            SetConsoleCP(65001);
+#endif
+        }
+    };
+    ConsoleEncodingSetter g_console_encoding_setter;
+}
+
+TEST(MetadataScanTest, FindMatchesPortable) {
+    // 후보 바이트가 자주 겹치도록 작은 알파벳으로 무작위 생성
+    const char alphabet[] = "ab\"s:,{";
+    std::mt19937 rng(42);
+    for (int i = 0; i < 50000; ++i) {
+        std::string haystack(rng() % 200, 'a');
+        for (auto& c : haystack) {
+            c = alphabet[rng() % 7];
+        }
+        std::string needle(1 + rng() % 6, 'a');
+        for (auto& c : needle) {
+            c = alphabet[rng() % 7];
+        }
+        size_t from = rng() % (haystack.size() + 2);
+        ASSERT_EQ(MetadataScan::Find(haystack, needle, from),
+                  MetadataScan::FindPortable(haystack, needle, from));
+    }
+}
+
+TEST(MetadataScanTest, DecodeMatchesFullParse) {
+    BatchMetadata original;
+    original.SetBatchId("01ARZ3NDEKTSV4RRFFQ69G5FAV");
+    original.SetSequenceStart(100);
+    original.SetSequenceEnd(199);
+    original.SetStatus(BatchStatus::LOADED);
+    original.SetCreatedAt(1700000000000);
+    original.SetLoadedAt(1700000000500);
+    original.SetSegment("01ARZ3NDEKTSV4RRFFQ69G5FAW.sst");
+    original.SetChecksums(true);
+    std::string json = original.toJson();
+
+    BatchMetadata decoded;
+    ASSERT_TRUE(MetadataScan::Decode(json, decoded));
+    EXPECT_EQ(decoded.GetBatchId(), original.GetBatchId());
+    EXPECT_EQ(decoded.GetSequenceStart(), 100);
+    EXPECT_EQ(decoded.GetSequenceEnd(), 199);
+    EXPECT_EQ(decoded.GetStatus(), BatchStatus::LOADED);
+    EXPECT_EQ(decoded.GetCreatedAt(), 1700000000000);
+    EXPECT_EQ(decoded.GetLoadedAt(), 1700000000500);
+    EXPECT_EQ(decoded.GetSegment(), original.GetSegment());
+    EXPECT_TRUE(decoded.HasChecksums());
+
+    // 선택 필드가 없으면 기본값으로 초기화
+    BatchMetadata pending;
+    pending.SetBatchId("01ARZ3NDEKTSV4RRFFQ69G5FAX");
+    pending.SetSequenceStart(0);
+    pending.SetSequenceEnd(99);
+    pending.SetCreatedAt(5);
+    std::string pending_json = pending.toJson();
+    ASSERT_TRUE(MetadataScan::Decode(pending_json, decoded));
+    EXPECT_EQ(decoded.GetStatus(), BatchStatus::PENDING);
+    EXPECT_EQ(decoded.GetLoadedAt(), 0);
+    EXPECT_TRUE(decoded.GetSegment().empty());
+    EXPECT_FALSE(decoded.HasChecksums());
+
+    BatchStatus status;
+    int64_t value = 0;
+    ASSERT_TRUE(MetadataScan::ProbeStatus(pending_json, status));
+    EXPECT_EQ(status, BatchStatus::PENDING);
+    ASSERT_TRUE(MetadataScan::ProbeInt64(pending_json, "sequence_end", value));
+    EXPECT_EQ(value, 99);
+}
+
+TEST(MetadataScanTest, UnexpectedFormatFallsBack) {
+    BatchStatus status;
+    int64_t value = 0;
+    BatchMetadata metadata;
+
+    // 공백, 실수 표기, 이스케이프, 누락 필드는 전체 파싱 대상
+    EXPECT_FALSE(MetadataScan::ProbeStatus(R"({"status": "pending"})", status));
+    EXPECT_FALSE(MetadataScan::ProbeStatus(R"({"status":"unknown"})", status));
+    EXPECT_FALSE(MetadataScan::ProbeInt64(R"({"sequence_start":1.5e3})", "sequence_start", value));
+    EXPECT_FALSE(MetadataScan::ProbeInt64(R"({"sequence_start":"1"})", "sequence_start", value));
+    EXPECT_FALSE(MetadataScan::Decode(
+        R"({"batch_id":"a\"b","sequence_start":0,"sequence_end":99,"status":"pending","created_at":5})", metadata));
+    EXPECT_FALSE(MetadataScan::Decode(R"({"batch_id":"a","sequence_start":0,"status":"pending"})", metadata));
+
+    // 문자열 값 안의 이스케이프된 패턴은 필드로 인식하지 않음
+    EXPECT_FALSE(MetadataScan::ProbeStatus(R"({"batch_id":"x\"status\":\"pending"})", status));
+    EXPECT_FALSE(MetadataScan::ProbeInt64(R"({"segment":"a","x":"b"})", "sequence_start", value));
+}
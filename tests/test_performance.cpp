@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 #include "durastash/group_storage.h"
+#include "durastash/replay_segment.h"
+#include "durastash/checksum.h"
+#include "durastash/basic_group_storage.h"
+#include "durastash/key_format.h"
+#include "durastash/metadata_scan.h"
 #include "test_utils.h"
 #include <filesystem>
 #include <fstream>
@@ -11,6 +16,10 @@
 #include <chrono>
 #include <random>
 #include <algorithm>
+#include <functional>
+#include <charconv>
+#include <sstream>
+#include <iomanip>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -355,36 +364,59 @@ TEST_F(PerformanceTest, BatchProcessingPerformance) {
 
 /**
  * 대용량 데이터 처리 성능 측정
+ * BlobDB 비활성/활성 각각의 처리량과 쓰기 증폭 비교
  */
 TEST_F(PerformanceTest, LargeDataPerformance) {
-    std::string group_key = "perf_group";
-    ASSERT_TRUE(storage_->InitializeSession(group_key));
-    
     const size_t num_operations = 100;
     const size_t data_size = 1024 * 1024; // 1MB per operation
     
     std::string data(data_size, 'L');
     
-    auto start = high_resolution_clock::now();
-    
-    for (size_t i = 0; i < num_operations; ++i) {
-        ASSERT_TRUE(storage_->Save(group_key, data + std::to_string(i)));
+    for (bool enable_blob_files : {false, true}) {
+        TestDirectoryGuard dir_guard("perf_large_db");
+        StorageOptions options;
+        options.enable_statistics = true;
+        options.enable_blob_files = enable_blob_files;
+        options.write_buffer_size = 8 * 1024 * 1024; // 플러시/컴팩션이 발생하도록 작은 메모리 테이블
+        
+        GroupStorage storage(dir_guard.GetPathString(), options);
+        ASSERT_TRUE(storage.Initialize());
+        
+        std::string group_key = "perf_group";
+        ASSERT_TRUE(storage.InitializeSession(group_key));
+        
+        auto start = high_resolution_clock::now();
+        
+        for (size_t i = 0; i < num_operations; ++i) {
+            ASSERT_TRUE(storage.Save(group_key, data + std::to_string(i)));
+        }
+        
+        auto end = high_resolution_clock::now();
+        auto duration = duration_cast<milliseconds>(end - start).count();
+        
+        // 메모리 테이블에 남은 데이터까지 디스크 기록량에 포함
+        ASSERT_TRUE(storage.Flush());
+        StorageStats stats = storage.GetStorageStats();
+        
+        double throughput = (double)num_operations * 1000.0 / duration;
+        double mbps = (double)num_operations * data_size / (1024.0 * 1024.0) / (duration / 1000.0);
+        
+        std::cout << "\n=== 대용량 데이터 처리 성능 (BlobDB " 
+                  << (enable_blob_files ? "활성" : "비활성") << ") ===" << std::endl;
+        std::cout << "작업 수: " << num_operations << std::endl;
+        std::cout << "데이터 크기: " << data_size / (1024 * 1024) << " MB per operation" << std::endl;
+        std::cout << "소요 시간: " << duration << " ms" << std::endl;
+        std::cout << "처리량: " << throughput << " ops/sec" << std::endl;
+        std::cout << "대역폭: " << mbps << " MB/s" << std::endl;
+        std::cout << "플러시 기록: " << stats.flush_bytes_written / (1024 * 1024) << " MB" << std::endl;
+        std::cout << "컴팩션 기록: " << stats.compaction_bytes_written / (1024 * 1024) << " MB" << std::endl;
+        std::cout << "blob 기록: " << stats.blob_bytes_written / (1024 * 1024) << " MB" << std::endl;
+        std::cout << "쓰기 증폭: " << stats.WriteAmplification() << std::endl;
+        
+        EXPECT_GT(mbps, 1.0); // 최소 1 MB/s 이상
+        
+        storage.Shutdown();
     }
-    
-    auto end = high_resolution_clock::now();
-    auto duration = duration_cast<milliseconds>(end - start).count();
-    
-    double throughput = (double)num_operations * 1000.0 / duration;
-    double mbps = (double)num_operations * data_size / (1024.0 * 1024.0) / (duration / 1000.0);
-    
-    std::cout << "\n=== 대용량 데이터 처리 성능 ===" << std::endl;
-    std::cout << "작업 수: " << num_operations << std::endl;
-    std::cout << "데이터 크기: " << data_size / (1024 * 1024) << " MB per operation" << std::endl;
-    std::cout << "소요 시간: " << duration << " ms" << std::endl;
-    std::cout << "처리량: " << throughput << " ops/sec" << std::endl;
-    std::cout << "대역폭: " << mbps << " MB/s" << std::endl;
-    
-    EXPECT_GT(mbps, 1.0); // 최소 1 MB/s 이상
 }
 
 /**
@@ -475,6 +507,1451 @@ TEST_F(PerformanceTest, LatencyMeasurement) {
     EXPECT_LT(p95, 10000); // P95가 10ms 이하
 }
 
+/**
+ * 콘텐츠 주소 기반 중복 제거 성능 측정 (공간 절감 및 CPU 비용)
+ * 팬아웃(같은 이벤트를 여러 그룹에 저장)과 반복 하트비트 페이로드 워크로드
+ */
+TEST_F(PerformanceTest, DedupSpaceSavingsAndCpuCost) {
+    const size_t num_events = 2000;
+    const size_t data_size = 4096;
+    const size_t num_heartbeat_variants = 16; // 반복되는 하트비트 페이로드 종류
+    const std::vector<std::string> fanout_groups = {"all_logs", "service", "errors"};
+    
+    struct RunResult {
+        int64_t duration_ms = 0;
+        uint64_t disk_bytes = 0;
+        DedupStats stats;
+    };
+    
+    auto run_workload = [&](size_t dedup_min_size) {
+        RunResult result;
+        TestDirectoryGuard dir_guard("perf_dedup_db");
+        StorageOptions options;
+        options.dedup_min_size = dedup_min_size;
+        
+        auto storage = std::make_unique<GroupStorage>(dir_guard.GetPathString(), options);
+        EXPECT_TRUE(storage->Initialize());
+        for (const auto& group : fanout_groups) {
+            EXPECT_TRUE(storage->InitializeSession(group));
+        }
+        
+        auto start = high_resolution_clock::now();
+        for (size_t i = 0; i < num_events; ++i) {
+            // 절반은 고유 이벤트, 절반은 반복 하트비트
+            std::string data(data_size, 'E');
+            if (i % 2 == 0) {
+                std::string tag = std::to_string(i);
+                data.replace(0, tag.size(), tag);
+            } else {
+                data[0] = static_cast<char>('a' + (i / 2) % num_heartbeat_variants);
+            }
+            
+            std::vector<std::pair<std::string, std::string>> entries;
+            for (const auto& group : fanout_groups) {
+                entries.emplace_back(group, data);
+            }
+            EXPECT_TRUE(storage->SaveMulti(entries));
+        }
+        auto end = high_resolution_clock::now();
+        
+        result.duration_ms = duration_cast<milliseconds>(end - start).count();
+        result.stats = storage->GetDedupStats();
+        storage->Shutdown();
+        storage.reset();
+        result.disk_bytes = GetDirectorySize(dir_guard.GetPath());
+        return result;
+    };
+    
+    RunResult baseline = run_workload(0);
+    RunResult dedup = run_workload(1024);
+    
+    uint64_t logical_bytes = static_cast<uint64_t>(num_events) * fanout_groups.size() * data_size;
+    double saved_ratio = 1.0 - (double)dedup.stats.stored_bytes / dedup.stats.payload_bytes;
+    double disk_ratio = (double)dedup.disk_bytes / baseline.disk_bytes;
+    double hash_ns_per_byte = (double)dedup.stats.hash_time_ns / dedup.stats.payload_bytes;
+    double overhead = (double)(dedup.duration_ms - baseline.duration_ms) / std::max<int64_t>(baseline.duration_ms, 1);
+    
+    std::cout << "\n=== 페이로드 중복 제거 성능 ===" << std::endl;
+    std::cout << "논리 페이로드: " << logical_bytes / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "저장된 페이로드 (중복 제거): " << dedup.stats.stored_bytes / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "참조로 대체된 페이로드 수: " << dedup.stats.deduplicated_count << std::endl;
+    std::cout << "페이로드 절감률: " << saved_ratio * 100 << " %" << std::endl;
+    std::cout << "디스크 사용량 (비활성/활성): " << baseline.disk_bytes / 1024 << " KB / "
+              << dedup.disk_bytes / 1024 << " KB (" << disk_ratio * 100 << " %)" << std::endl;
+    std::cout << "해시 비용: " << hash_ns_per_byte << " ns/byte" << std::endl;
+    std::cout << "소요 시간 (비활성/활성): " << baseline.duration_ms << " ms / "
+              << dedup.duration_ms << " ms (" << overhead * 100 << " %)" << std::endl;
+    
+    EXPECT_GT(saved_ratio, 0.5); // 팬아웃 3배 + 반복 하트비트로 절반 이상 절감
+}
+
+/**
+ * 큐 워크로드 컴팩션 프로파일 비교
+ * append 후 헤드부터 ACK하는 워크로드에서 프로파일별 쓰기 증폭, 공간 증폭, P99 Save 지연시간 측정
+ */
+TEST_F(PerformanceTest, QueueWorkloadCompactionProfiles) {
+    const size_t num_operations = 20000;
+    const size_t data_size = 1024;
+    const size_t batch_size = 100;
+    const size_t backlog_batches = 20; // 소비자가 유지하는 미처리 배치 수
+    
+    struct ProfileCase {
+        const char* name;
+        CompactionProfile profile;
+    };
+    const std::vector<ProfileCase> cases = {
+        {"LEVELED", CompactionProfile::LEVELED},
+        {"UNIVERSAL", CompactionProfile::UNIVERSAL},
+    };
+    
+    std::string data(data_size, 'Q');
+    
+    for (const auto& profile_case : cases) {
+        TestDirectoryGuard dir_guard("perf_queue_db");
+        StorageOptions options;
+        options.enable_statistics = true;
+        options.compaction_profile = profile_case.profile;
+        options.write_buffer_size = 4 * 1024 * 1024;
+        
+        GroupStorage storage(dir_guard.GetPathString(), options);
+        ASSERT_TRUE(storage.Initialize());
+        
+        std::string group_key = "queue_group";
+        ASSERT_TRUE(storage.InitializeSession(group_key));
+        storage.SetBatchSize(batch_size);
+        
+        std::vector<double> latencies;
+        latencies.reserve(num_operations);
+        size_t acked_records = 0;
+        
+        for (size_t i = 0; i < num_operations; ++i) {
+            auto start = high_resolution_clock::now();
+            ASSERT_TRUE(storage.Save(group_key, data));
+            auto end = high_resolution_clock::now();
+            latencies.push_back(duration_cast<microseconds>(end - start).count());
+            
+            // 미처리 배치가 backlog_batches를 넘으면 헤드 배치 소비 및 ACK
+            if ((i + 1) % batch_size == 0 && (i + 1) / batch_size > backlog_batches) {
+                auto batches = storage.LoadBatch(group_key, 1);
+                for (const auto& batch : batches) {
+                    storage.AcknowledgeBatch(group_key, batch.batch_id);
+                    acked_records += batch.data.size();
+                }
+            }
+        }
+        
+        ASSERT_TRUE(storage.Flush());
+        StorageStats stats = storage.GetStorageStats();
+        
+        std::sort(latencies.begin(), latencies.end());
+        double p50 = latencies[static_cast<size_t>(latencies.size() * 0.5)];
+        double p99 = latencies[static_cast<size_t>(latencies.size() * 0.99)];
+        
+        uint64_t live_bytes = static_cast<uint64_t>(num_operations - acked_records) * data_size;
+        double space_amp = live_bytes > 0 ? (double)stats.sst_files_size / live_bytes : 0.0;
+        
+        std::cout << "\n=== 큐 워크로드 컴팩션 프로파일: " << profile_case.name << " ===" << std::endl;
+        std::cout << "Save 수: " << num_operations << ", ACK된 레코드 수: " << acked_records << std::endl;
+        std::cout << "쓰기 증폭: " << stats.WriteAmplification() << std::endl;
+        std::cout << "공간 증폭 (SST 크기 / 미처리 데이터): " << space_amp << std::endl;
+        std::cout << "P50 Save 지연시간: " << p50 << " us" << std::endl;
+        std::cout << "P99 Save 지연시간: " << p99 << " us" << std::endl;
+        
+        EXPECT_GT(acked_records, 0);
+        
+        storage.Shutdown();
+    }
+}
+
+TEST_F(PerformanceTest, HeadTombstoneCompactionLoadLatency) {
+    // 원래 목표는 1천만 건 ACK이나 ctest 실행 시간을 고려해 축소 (num_records로 조정)
+    const size_t num_records = 200000;
+    const size_t data_size = 64;
+    const size_t batch_size = 1000;
+    const size_t remaining_batches = 10; // ACK하지 않고 남겨둘 배치 수
+    const size_t load_iterations = 20;
+    
+    struct CompactionCase {
+        const char* name;
+        bool head_compaction;
+    };
+    const std::vector<CompactionCase> cases = {
+        {"헤드 컴팩션 없음", false},
+        {"헤드 컴팩션", true},
+    };
+    
+    std::string data(data_size, 'T');
+    
+    for (const auto& compaction_case : cases) {
+        TestDirectoryGuard dir_guard("perf_tombstone_db");
+        StorageOptions options;
+        if (compaction_case.head_compaction) {
+            options.head_compaction_threshold = 100000;
+            options.deletion_compaction_window = 128 * 1024;
+        }
+        
+        GroupStorage storage(dir_guard.GetPathString(), options);
+        ASSERT_TRUE(storage.Initialize());
+        
+        std::string group_key = "tombstone_group";
+        ASSERT_TRUE(storage.InitializeSession(group_key));
+        storage.SetBatchSize(batch_size);
+        
+        // 배치 단위로 한 번에 저장 (단일 동기 쓰기)
+        std::vector<std::pair<std::string, std::string>> entries(batch_size, {group_key, data});
+        for (size_t i = 0; i < num_records / batch_size; ++i) {
+            ASSERT_TRUE(storage.SaveMulti(entries));
+        }
+        
+        // 헤드부터 ACK하여 키 공간 앞쪽에 삭제 마커 누적
+        size_t acked_records = 0;
+        size_t batches_to_ack = num_records / batch_size - remaining_batches;
+        auto ack_start = high_resolution_clock::now();
+        for (size_t i = 0; i < batches_to_ack; ++i) {
+            auto batches = storage.LoadBatch(group_key, 1);
+            ASSERT_EQ(batches.size(), 1);
+            ASSERT_TRUE(storage.AcknowledgeBatch(group_key, batches[0].batch_id));
+            acked_records += batches[0].data.size();
+        }
+        auto ack_end = high_resolution_clock::now();
+        
+        ASSERT_TRUE(storage.Flush());
+        if (compaction_case.head_compaction) {
+            // 백그라운드 트리거와 동일한 범위를 동기 실행하여 측정 조건 고정
+            ASSERT_TRUE(storage.CompactAckedHead(group_key));
+        }
+        
+        std::vector<double> latencies;
+        latencies.reserve(load_iterations);
+        for (size_t i = 0; i < load_iterations; ++i) {
+            auto start = high_resolution_clock::now();
+            auto values = storage.Load(group_key);
+            auto end = high_resolution_clock::now();
+            ASSERT_EQ(values.size(), remaining_batches * batch_size);
+            latencies.push_back(duration_cast<microseconds>(end - start).count());
+        }
+        
+        auto head_start = high_resolution_clock::now();
+        auto head_batches = storage.LoadBatch(group_key, 1);
+        auto head_end = high_resolution_clock::now();
+        ASSERT_EQ(head_batches.size(), 1);
+        
+        std::sort(latencies.begin(), latencies.end());
+        double p50 = latencies[static_cast<size_t>(latencies.size() * 0.5)];
+        double p99 = latencies[static_cast<size_t>(latencies.size() * 0.99)];
+        StorageStats stats = storage.GetStorageStats();
+        
+        std::cout << "\n=== 헤드 삭제 마커 로드 지연시간: " << compaction_case.name << " ===" << std::endl;
+        std::cout << "ACK된 레코드 수: " << acked_records << std::endl;
+        std::cout << "ACK 소요 시간: "
+                  << duration_cast<milliseconds>(ack_end - ack_start).count() << " ms" << std::endl;
+        std::cout << "SST 파일 크기: " << stats.sst_files_size << " bytes" << std::endl;
+        std::cout << "P50 Load 지연시간: " << p50 << " us" << std::endl;
+        std::cout << "P99 Load 지연시간: " << p99 << " us" << std::endl;
+        std::cout << "헤드 LoadBatch 지연시간: "
+                  << duration_cast<microseconds>(head_end - head_start).count() << " us" << std::endl;
+        
+        EXPECT_EQ(acked_records, batches_to_ack * batch_size);
+        
+        storage.Shutdown();
+    }
+}
+
+TEST_F(PerformanceTest, StreamingConsumerLatency) {
+    const size_t num_records = 2000;
+    const size_t backlog_records = 20000; // 소비자 시작 전에 쌓여 있는 레코드 수
+    
+    struct ConsumerCase {
+        const char* name;
+        bool tailing;
+    };
+    const std::vector<ConsumerCase> cases = {
+        {"Load 재조회 (매번 처음부터 스캔)", false},
+        {"테일링 소비자", true},
+    };
+    
+    for (const auto& consumer_case : cases) {
+        TestDirectoryGuard dir_guard("perf_stream_db");
+        GroupStorage storage(dir_guard.GetPathString());
+        ASSERT_TRUE(storage.Initialize());
+        
+        std::string group_key = "stream_group";
+        ASSERT_TRUE(storage.InitializeSession(group_key));
+        storage.SetBatchSize(1000);
+        
+        std::vector<std::pair<std::string, std::string>> entries(1000, {group_key, "backlog"});
+        for (size_t i = 0; i < backlog_records / entries.size(); ++i) {
+            ASSERT_TRUE(storage.SaveMulti(entries));
+        }
+        
+        // 테일링 소비자는 백로그를 먼저 따라잡은 뒤 측정
+        auto consumer = storage.CreateConsumer(group_key);
+        ASSERT_NE(consumer, nullptr);
+        ASSERT_EQ(consumer->Poll().size(), backlog_records);
+        size_t delivered = backlog_records;
+        
+        // 페이로드에 저장 시각(ns)을 기록하여 저장→전달 지연시간 측정
+        std::thread producer([&]() {
+            for (size_t i = 0; i < num_records; ++i) {
+                auto now = duration_cast<nanoseconds>(
+                    high_resolution_clock::now().time_since_epoch()).count();
+                storage.Save(group_key, std::to_string(now));
+            }
+        });
+        
+        std::vector<double> latencies;
+        latencies.reserve(num_records);
+        while (latencies.size() < num_records) {
+            std::vector<std::string> values;
+            if (consumer_case.tailing) {
+                values = consumer->Poll();
+            } else {
+                auto all = storage.Load(group_key);
+                if (all.size() > delivered) {
+                    values.assign(all.begin() + delivered, all.end());
+                }
+            }
+            
+            auto now = duration_cast<nanoseconds>(
+                high_resolution_clock::now().time_since_epoch()).count();
+            for (const auto& value : values) {
+                latencies.push_back((now - std::stoll(value)) / 1000.0);
+            }
+            delivered += values.size();
+            
+            if (values.empty()) {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        consumer.reset();
+        
+        std::sort(latencies.begin(), latencies.end());
+        double p50 = latencies[static_cast<size_t>(latencies.size() * 0.5)];
+        double p99 = latencies[static_cast<size_t>(latencies.size() * 0.99)];
+        
+        std::cout << "\n=== 스트리밍 지연시간: " << consumer_case.name << " ===" << std::endl;
+        std::cout << "백로그 레코드 수: " << backlog_records << ", 스트리밍 레코드 수: " << num_records << std::endl;
+        std::cout << "P50 저장→전달 지연시간: " << p50 << " us" << std::endl;
+        std::cout << "P99 저장→전달 지연시간: " << p99 << " us" << std::endl;
+        
+        EXPECT_EQ(latencies.size(), num_records);
+        
+        storage.Shutdown();
+    }
+}
+
+TEST_F(PerformanceTest, ColdCacheLoadThroughput) {
+    const size_t num_records = 50000;
+    const size_t data_size = 1024;
+    const size_t batch_size = 1000;
+    
+    struct ReadCase {
+        const char* name;
+        size_t readahead_size;
+        bool adaptive_readahead;
+        bool async_io;
+    };
+    const std::vector<ReadCase> cases = {
+        {"기본 (자동 readahead)", 0, false, false},
+        {"readahead 2MB", 2 * 1024 * 1024, false, false},
+        {"adaptive readahead", 0, true, false},
+        {"adaptive readahead + async_io", 0, true, true},
+    };
+    
+    std::string data(data_size, 'C');
+    
+    for (const auto& read_case : cases) {
+        TestDirectoryGuard dir_guard("perf_cold_load_db");
+        StorageOptions options;
+        options.readahead_size = read_case.readahead_size;
+        options.adaptive_readahead = read_case.adaptive_readahead;
+        options.async_io = read_case.async_io;
+        
+        GroupStorage storage(dir_guard.GetPathString(), options);
+        ASSERT_TRUE(storage.Initialize());
+        
+        std::string group_key = "cold_group";
+        ASSERT_TRUE(storage.InitializeSession(group_key));
+        storage.SetBatchSize(batch_size);
+        
+        std::vector<std::pair<std::string, std::string>> entries(batch_size, {group_key, data});
+        for (size_t i = 0; i < num_records / batch_size; ++i) {
+            ASSERT_TRUE(storage.SaveMulti(entries));
+        }
+        
+        // 플러시된 SST는 블록 캐시에 올라가지 않으므로 OS 페이지 캐시만 비우면 콜드 상태
+        ASSERT_TRUE(storage.Flush());
+        bool evicted = EvictFromPageCache(dir_guard.GetPath());
+        
+        auto start = high_resolution_clock::now();
+        auto values = storage.Load(group_key);
+        auto end = high_resolution_clock::now();
+        ASSERT_EQ(values.size(), num_records);
+        
+        auto duration_us = duration_cast<microseconds>(end - start).count();
+        double mb = static_cast<double>(num_records * data_size) / (1024.0 * 1024.0);
+        double throughput = duration_us > 0 ? mb / (duration_us / 1000000.0) : 0.0;
+        
+        std::cout << "\n=== 콜드 캐시 Load 처리량: " << read_case.name << " ===" << std::endl;
+        std::cout << "페이지 캐시 제거: " << (evicted ? "예" : "미지원") << std::endl;
+        std::cout << "레코드 수: " << num_records << ", 데이터 크기: " << mb << " MB" << std::endl;
+        std::cout << "소요 시간: " << duration_us / 1000.0 << " ms" << std::endl;
+        std::cout << "처리량: " << throughput << " MB/s" << std::endl;
+        
+        storage.Shutdown();
+    }
+}
+
+TEST_F(PerformanceTest, MemoryBudgetBoundsRss) {
+    const size_t num_stores = 16;
+    const size_t budget_capacity = 64 * 1024 * 1024;
+    const size_t data_size = 1024;
+    const size_t records_per_store = 8192; // 저장소당 8MB (전체 128MB, 예산의 2배)
+    // 스레드 스택, 테이블 리더, 할당자 단편화 등 예산 밖 메모리 허용치
+    const uint64_t rss_slack = 96 * 1024 * 1024;
+    
+    uint64_t baseline_rss = GetResidentSetSize();
+    if (baseline_rss == 0) {
+        GTEST_SKIP() << "RSS 측정 미지원 환경";
+    }
+    
+    auto budget = MemoryBudget::Create(budget_capacity, 0.5);
+    StorageOptions options;
+    options.memory_budget = budget;
+    
+    std::vector<std::unique_ptr<TestDirectoryGuard>> dir_guards;
+    std::vector<std::unique_ptr<GroupStorage>> stores;
+    for (size_t i = 0; i < num_stores; ++i) {
+        dir_guards.push_back(std::make_unique<TestDirectoryGuard>("perf_budget_db"));
+        stores.push_back(std::make_unique<GroupStorage>(dir_guards.back()->GetPathString(), options));
+        ASSERT_TRUE(stores.back()->Initialize());
+        ASSERT_TRUE(stores.back()->InitializeSession("budget_group"));
+    }
+    
+    std::string data(data_size, 'R');
+    std::vector<std::pair<std::string, std::string>> entries(1024, {"budget_group", data});
+    uint64_t peak_rss = baseline_rss;
+    auto start = high_resolution_clock::now();
+    for (size_t round = 0; round < records_per_store / entries.size(); ++round) {
+        for (auto& store : stores) {
+            ASSERT_TRUE(store->SaveMulti(entries));
+        }
+        peak_rss = std::max(peak_rss, GetResidentSetSize());
+    }
+    auto end = high_resolution_clock::now();
+    
+    uint64_t total_memtable_bytes = 0;
+    for (auto& store : stores) {
+        total_memtable_bytes += store->GetStorageStats().memtable_bytes;
+    }
+    
+    std::cout << "\n=== 공유 메모리 예산 RSS ===" << std::endl;
+    std::cout << "저장소 수: " << num_stores << ", 예산: " << budget_capacity / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "기록 데이터: " << (num_stores * records_per_store * data_size) / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "소요 시간: " << duration_cast<milliseconds>(end - start).count() << " ms" << std::endl;
+    std::cout << "메모리 테이블 합계: " << total_memtable_bytes / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "공유 캐시 사용량: " << budget->GetUsage() / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "RSS 증가량 (최대): " << (peak_rss - baseline_rss) / (1024 * 1024) << " MB" << std::endl;
+    
+    EXPECT_LE(total_memtable_bytes, budget->GetWriteBufferLimit() + budget_capacity / 4);
+    EXPECT_LE(peak_rss - baseline_rss, budget_capacity + rss_slack);
+    
+    for (auto& store : stores) {
+        store->Shutdown();
+    }
+}
+
+TEST_F(PerformanceTest, RateLimitedBackgroundIoLatency) {
+    const size_t num_samples = 2000;
+    const size_t data_size = 256;
+    const size_t background_payload_size = 4096;
+    
+    struct LimiterCase {
+        const char* name;
+        int64_t rate_limit_bytes_per_sec;
+    };
+    const std::vector<LimiterCase> cases = {
+        {"속도 제한 없음", 0},
+        {"자동 튜닝 속도 제한 (상한 64MB/s)", 64LL * 1024 * 1024},
+    };
+    
+    std::string data(data_size, 'F');
+    std::string background_data(background_payload_size, 'B');
+    
+    for (const auto& limiter_case : cases) {
+        TestDirectoryGuard dir_guard("perf_rate_limit_db");
+        StorageOptions options;
+        options.rate_limit_bytes_per_sec = limiter_case.rate_limit_bytes_per_sec;
+        options.write_buffer_size = 4 * 1024 * 1024; // 잦은 플러시/컴팩션 유도
+        options.enable_statistics = true;
+        
+        GroupStorage storage(dir_guard.GetPathString(), options);
+        ASSERT_TRUE(storage.Initialize());
+        
+        std::string foreground_group = "foreground_group";
+        std::string background_group = "background_group";
+        ASSERT_TRUE(storage.InitializeSession(foreground_group));
+        ASSERT_TRUE(storage.InitializeSession(background_group));
+        storage.SetBatchSize(1000);
+        
+        // 백그라운드: 대량 쓰기 + 헤드 ACK로 플러시/컴팩션 부하 지속 발생
+        std::atomic<bool> stop{false};
+        std::thread background([&]() {
+            std::vector<std::pair<std::string, std::string>> entries(1000, {background_group, background_data});
+            while (!stop) {
+                storage.SaveMulti(entries);
+                auto batches = storage.LoadBatch(background_group, 1);
+                for (const auto& batch : batches) {
+                    storage.AcknowledgeBatch(background_group, batch.batch_id);
+                }
+            }
+        });
+        
+        std::vector<double> latencies;
+        latencies.reserve(num_samples);
+        for (size_t i = 0; i < num_samples; ++i) {
+            auto start = high_resolution_clock::now();
+            ASSERT_TRUE(storage.Save(foreground_group, data));
+            auto end = high_resolution_clock::now();
+            latencies.push_back(duration_cast<microseconds>(end - start).count());
+        }
+        
+        stop = true;
+        background.join();
+        
+        std::sort(latencies.begin(), latencies.end());
+        double p50 = latencies[static_cast<size_t>(num_samples * 0.5)];
+        double p99 = latencies[static_cast<size_t>(num_samples * 0.99)];
+        double p999 = latencies[static_cast<size_t>(num_samples * 0.999)];
+        StorageStats stats = storage.GetStorageStats();
+        
+        std::cout << "\n=== 백그라운드 I/O 부하 중 Save 지연시간: " << limiter_case.name << " ===" << std::endl;
+        std::cout << "샘플 수: " << num_samples << std::endl;
+        std::cout << "P50: " << p50 << " us" << std::endl;
+        std::cout << "P99: " << p99 << " us" << std::endl;
+        std::cout << "P99.9: " << p999 << " us" << std::endl;
+        std::cout << "컴팩션 기록 바이트: " << stats.compaction_bytes_written << std::endl;
+        std::cout << "현재 속도 상한: " << stats.rate_limit_bytes_per_sec << " bytes/s" << std::endl;
+        std::cout << "속도 제한기 통과 바이트: " << stats.rate_limited_bytes << std::endl;
+        
+        storage.Shutdown();
+    }
+}
+
+TEST_F(PerformanceTest, OpenTimeBySstCount) {
+    const std::vector<size_t> sst_counts = {100, 500, 2000};
+    const size_t num_groups = 200;
+    
+    struct OpenCase {
+        const char* name;
+        bool fast_open;
+    };
+    const std::vector<OpenCase> cases = {
+        {"기본 오픈", false},
+        {"빠른 오픈 + 지연 복구", true},
+    };
+    
+    for (size_t sst_count : sst_counts) {
+        TestDirectoryGuard dir_guard("perf_open_db");
+        
+        {
+            GroupStorage storage(dir_guard.GetPathString());
+            ASSERT_TRUE(storage.Initialize());
+            
+            std::vector<std::pair<std::string, std::string>> entries;
+            for (size_t g = 0; g < num_groups; ++g) {
+                entries.push_back({"open_group_" + std::to_string(g), "payload"});
+            }
+            ASSERT_TRUE(storage.SaveMulti(entries));
+            storage.Shutdown();
+        }
+        
+        // 키 범위가 겹치지 않는 SST를 수집하면 병합되지 않고 최하위 레벨에 파일 단위로 유지됨
+        {
+            TestDirectoryGuard sst_dir("perf_open_sst");
+            std::vector<std::string> sst_paths;
+            auto raw = CreateStorage(StorageOptions());
+            for (size_t i = 0; i < sst_count; ++i) {
+                std::string path = (sst_dir.GetPath() / ("filler_" + std::to_string(i) + ".sst")).string();
+                auto writer = raw->NewExternalFileWriter();
+                ASSERT_TRUE(writer->Open(path));
+                for (size_t g = 0; g < num_groups; ++g) {
+                    std::ostringstream key;
+                    key << "open_filler:" << std::setw(8) << std::setfill('0') << i
+                        << ":" << std::setw(8) << std::setfill('0') << g;
+                    ASSERT_TRUE(writer->Put(key.str(), "payload"));
+                }
+                ASSERT_TRUE(writer->Finish());
+                sst_paths.push_back(path);
+            }
+            ASSERT_TRUE(raw->Initialize(dir_guard.GetPathString()));
+            ASSERT_TRUE(raw->IngestExternalFiles(sst_paths, true));
+            raw->Shutdown();
+        }
+        
+        size_t sst_files = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(dir_guard.GetPath())) {
+            if (entry.path().extension() == ".sst") {
+                sst_files++;
+            }
+        }
+        
+        for (const auto& open_case : cases) {
+            EvictFromPageCache(dir_guard.GetPath());
+            
+            StorageOptions options;
+            if (open_case.fast_open) {
+                options.max_open_files = 256;
+                options.skip_stats_update_on_db_open = true;
+                options.skip_checking_sst_file_sizes_on_db_open = true;
+                options.lazy_recovery = true;
+            }
+            
+            auto open_start = high_resolution_clock::now();
+            GroupStorage storage(dir_guard.GetPathString(), options);
+            ASSERT_TRUE(storage.Initialize());
+            auto open_end = high_resolution_clock::now();
+            
+            ASSERT_TRUE(storage.InitializeSession("open_group_0"));
+            ASSERT_TRUE(storage.Save("open_group_0", "first"));
+            auto first_save_end = high_resolution_clock::now();
+            
+            storage.WaitForRecovery();
+            auto recovery_end = high_resolution_clock::now();
+            EXPECT_EQ(storage.ListGroups().size(), num_groups);
+            
+            std::cout << "\n=== DB 오픈 시간: " << open_case.name << " (SST " << sst_files << "개) ===" << std::endl;
+            std::cout << "Initialize: " << duration_cast<microseconds>(open_end - open_start).count() / 1000.0
+                      << " ms" << std::endl;
+            std::cout << "첫 Save 완료: " << duration_cast<microseconds>(first_save_end - open_start).count() / 1000.0
+                      << " ms" << std::endl;
+            std::cout << "복구 완료: " << duration_cast<microseconds>(recovery_end - open_start).count() / 1000.0
+                      << " ms" << std::endl;
+            
+            storage.Shutdown();
+        }
+    }
+}
+
+TEST_F(PerformanceTest, OnlineBackupDuringSaves) {
+    const size_t preload_records = 50000;
+    const size_t data_size = 1024;
+    const size_t num_snapshots = 5;
+    
+    std::string group_key = "backup_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(1000);
+    
+    std::string data(data_size, 'K');
+    std::vector<std::pair<std::string, std::string>> entries(1000, {group_key, data});
+    for (size_t i = 0; i < preload_records / entries.size(); ++i) {
+        ASSERT_TRUE(storage_->SaveMulti(entries));
+    }
+    ASSERT_TRUE(storage_->Flush());
+    
+    // 백업/체크포인트 중 포그라운드 Save 지연시간 측정
+    std::atomic<bool> stop{false};
+    std::vector<double> save_latencies;
+    std::thread writer([&]() {
+        while (!stop) {
+            auto start = high_resolution_clock::now();
+            storage_->Save(group_key, data);
+            auto end = high_resolution_clock::now();
+            save_latencies.push_back(duration_cast<microseconds>(end - start).count());
+        }
+    });
+    
+    TestDirectoryGuard snapshot_root("perf_backup_root");
+    std::vector<double> checkpoint_ms;
+    std::vector<double> backup_ms;
+    for (size_t i = 0; i < num_snapshots; ++i) {
+        std::string checkpoint_dir = (snapshot_root.GetPath() / ("checkpoint_" + std::to_string(i))).string();
+        auto start = high_resolution_clock::now();
+        EXPECT_TRUE(storage_->CreateCheckpoint(checkpoint_dir));
+        auto end = high_resolution_clock::now();
+        checkpoint_ms.push_back(duration_cast<microseconds>(end - start).count() / 1000.0);
+        
+        start = high_resolution_clock::now();
+        EXPECT_TRUE(storage_->CreateBackup((snapshot_root.GetPath() / "backups").string()));
+        end = high_resolution_clock::now();
+        backup_ms.push_back(duration_cast<microseconds>(end - start).count() / 1000.0);
+    }
+    
+    stop = true;
+    writer.join();
+    
+    std::sort(save_latencies.begin(), save_latencies.end());
+    double p99 = save_latencies[static_cast<size_t>(save_latencies.size() * 0.99)];
+    double max_latency = save_latencies.back();
+    
+    std::cout << "\n=== 온라인 백업/체크포인트 ===" << std::endl;
+    std::cout << "사전 적재: " << preload_records << " 레코드" << std::endl;
+    for (size_t i = 0; i < num_snapshots; ++i) {
+        std::cout << "#" << i << " 체크포인트: " << checkpoint_ms[i] << " ms, 증분 백업: "
+                  << backup_ms[i] << " ms" << std::endl;
+    }
+    std::cout << "동시 Save 수: " << save_latencies.size() << std::endl;
+    std::cout << "동시 Save P99: " << p99 << " us, 최대: " << max_latency << " us" << std::endl;
+    
+    EXPECT_FALSE(save_latencies.empty());
+}
+
+TEST_F(PerformanceTest, ExportImportVersusResave) {
+    const size_t num_records = 200000;
+    const size_t data_size = 1024;
+    
+    std::string group_key = "export_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(1000);
+    
+    std::string data(data_size, 'E');
+    std::vector<std::pair<std::string, std::string>> entries(1000, {group_key, data});
+    for (size_t i = 0; i < num_records / entries.size(); ++i) {
+        ASSERT_TRUE(storage_->SaveMulti(entries));
+    }
+    
+    // 기준: 레코드 단위 Load + Save로 다른 저장소에 이관
+    TestDirectoryGuard resave_dir("perf_resave_db");
+    double resave_ms = 0;
+    {
+        GroupStorage target(resave_dir.GetPathString());
+        ASSERT_TRUE(target.Initialize());
+        ASSERT_TRUE(target.InitializeSession(group_key));
+        target.SetBatchSize(1000);
+        
+        auto start = high_resolution_clock::now();
+        auto values = storage_->Load(group_key);
+        for (const auto& value : values) {
+            ASSERT_TRUE(target.Save(group_key, value));
+        }
+        auto end = high_resolution_clock::now();
+        resave_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+        target.Shutdown();
+    }
+    
+    // 외부 SST 내보내기 + 수집
+    TestDirectoryGuard export_dir("perf_export_files");
+    TestDirectoryGuard import_dir("perf_import_db");
+    std::string export_path = (export_dir.GetPath() / "group.sst").string();
+    double export_ms = 0;
+    double import_ms = 0;
+    {
+        auto start = high_resolution_clock::now();
+        ASSERT_TRUE(storage_->ExportGroup(group_key, export_path));
+        auto end = high_resolution_clock::now();
+        export_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+        
+        GroupStorage target(import_dir.GetPathString());
+        ASSERT_TRUE(target.Initialize());
+        ASSERT_TRUE(target.InitializeSession(group_key));
+        target.SetBatchSize(1000);
+        
+        start = high_resolution_clock::now();
+        ASSERT_TRUE(target.ImportGroup(export_path));
+        end = high_resolution_clock::now();
+        import_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+        
+        EXPECT_EQ(target.Load(group_key).size(), num_records);
+        target.Shutdown();
+    }
+    
+    double mb = (num_records * data_size) / (1024.0 * 1024.0);
+    std::cout << "\n=== 그룹 이관: 레코드 재저장 vs SST 내보내기/수집 ===" << std::endl;
+    std::cout << "레코드 수: " << num_records << ", 데이터 크기: " << mb << " MB" << std::endl;
+    std::cout << "Load + Save: " << resave_ms << " ms" << std::endl;
+    std::cout << "ExportGroup: " << export_ms << " ms, ImportGroup: " << import_ms << " ms" << std::endl;
+    std::cout << "개선 배율: " << resave_ms / (export_ms + import_ms) << "x" << std::endl;
+}
+
+TEST_F(PerformanceTest, ColdTierSpillBacklog) {
+    const size_t num_records = 200000;
+    const size_t data_size = 1024;
+    
+    // 콜드 티어 활성화된 저장소로 다시 열기 (경과 시간 조건 없음)
+    TestDirectoryGuard cold_dir("perf_cold_tier");
+    storage_->Shutdown();
+    StorageOptions options;
+    options.cold_tier_path = cold_dir.GetPathString();
+    options.cold_tier_min_age_ms = 0;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "cold_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(1000);
+    
+    // JSON 형태의 압축 가능한 페이로드
+    std::vector<std::pair<std::string, std::string>> entries;
+    for (size_t i = 0; i < 1000; ++i) {
+        std::string data = "{\"id\":" + std::to_string(i) + ",\"payload\":\"";
+        data.resize(data_size - 2, static_cast<char>('a' + i % 26));
+        entries.push_back({group_key, data + "\"}"});
+    }
+    for (size_t i = 0; i < num_records / entries.size(); ++i) {
+        ASSERT_TRUE(storage_->SaveMulti(entries));
+    }
+    ASSERT_TRUE(storage_->Flush());
+    uint64_t hot_before = GetDirectorySize(test_dir_guard_->GetPath());
+    
+    auto start = high_resolution_clock::now();
+    size_t spilled = storage_->SpillColdBatches(group_key);
+    auto end = high_resolution_clock::now();
+    double spill_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    EXPECT_EQ(spilled, num_records / 1000);
+    
+    // 범위 삭제된 데이터의 백그라운드 컴팩션 대기 (최대 10초)
+    uint64_t hot_after = hot_before;
+    for (int i = 0; i < 50 && hot_after > hot_before / 2; ++i) {
+        std::this_thread::sleep_for(milliseconds(200));
+        hot_after = GetDirectorySize(test_dir_guard_->GetPath());
+    }
+    uint64_t cold_size = GetDirectorySize(cold_dir.GetPath());
+    
+    start = high_resolution_clock::now();
+    auto batches = storage_->LoadBatch(group_key, spilled);
+    end = high_resolution_clock::now();
+    double load_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    size_t loaded_records = 0;
+    for (const auto& batch : batches) {
+        loaded_records += batch.data.size();
+    }
+    EXPECT_EQ(loaded_records, num_records);
+    
+    double mb = (num_records * data_size) / (1024.0 * 1024.0);
+    std::cout << "\n=== 콜드 티어 세그먼트 이동 ===" << std::endl;
+    std::cout << "레코드 수: " << num_records << ", 데이터 크기: " << mb << " MB" << std::endl;
+    std::cout << "이동 배치: " << spilled << ", 소요 시간: " << spill_ms << " ms" << std::endl;
+    std::cout << "주 저장소 크기: " << hot_before / (1024.0 * 1024.0) << " MB -> "
+              << hot_after / (1024.0 * 1024.0) << " MB" << std::endl;
+    std::cout << "세그먼트 크기: " << cold_size / (1024.0 * 1024.0) << " MB" << std::endl;
+    std::cout << "세그먼트 LoadBatch: " << load_ms << " ms (" << mb / (load_ms / 1000.0) << " MB/s)" << std::endl;
+}
+
+TEST_F(PerformanceTest, ReplaySegmentThroughput) {
+    const size_t num_records = 200000;
+    const size_t data_size = 1024;
+    const int num_passes = 5;
+    
+    std::string group_key = "replay_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(1000);
+    
+    std::string data(data_size, 'R');
+    std::vector<std::pair<std::string, std::string>> entries(1000, {group_key, data});
+    for (size_t i = 0; i < num_records / entries.size(); ++i) {
+        ASSERT_TRUE(storage_->SaveMulti(entries));
+    }
+    ASSERT_TRUE(storage_->Flush());
+    
+    TestDirectoryGuard replay_dir("perf_replay_files");
+    std::string path = (replay_dir.GetPath() / "group.replay").string();
+    auto start = high_resolution_clock::now();
+    ASSERT_TRUE(storage_->SnapshotGroup(group_key, path));
+    auto end = high_resolution_clock::now();
+    double snapshot_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    
+    double mb = (num_records * data_size) / (1024.0 * 1024.0);
+    std::cout << "\n=== 리플레이 세그먼트 (mmap) vs Load ===" << std::endl;
+    std::cout << "레코드 수: " << num_records << ", 데이터 크기: " << mb << " MB" << std::endl;
+    std::cout << "SnapshotGroup: " << snapshot_ms << " ms" << std::endl;
+    
+    for (int pass = 0; pass < num_passes; ++pass) {
+        // 라이브 그룹 전체 Load
+        start = high_resolution_clock::now();
+        auto values = storage_->Load(group_key);
+        end = high_resolution_clock::now();
+        double load_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+        EXPECT_EQ(values.size(), num_records);
+        
+        // 매핑된 세그먼트 순회 (값은 복사 없이 바이트 합계만 계산)
+        start = high_resolution_clock::now();
+        auto cursor = OpenReplaySegment(path, pass == 0);
+        ASSERT_NE(cursor, nullptr);
+        size_t replayed = 0;
+        uint64_t bytes = 0;
+        for (cursor->Seek(""); cursor->Valid(); cursor->Next()) {
+            bytes += static_cast<unsigned char>(cursor->Value()[0]) + cursor->Value().size();
+            replayed++;
+        }
+        end = high_resolution_clock::now();
+        double replay_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+        EXPECT_EQ(replayed, num_records);
+        EXPECT_GT(bytes, 0u);
+        
+        std::cout << "#" << pass << (pass == 0 ? " (체크섬 검증)" : "") << " Load: " << load_ms
+                  << " ms (" << mb / (load_ms / 1000.0) << " MB/s), 리플레이: " << replay_ms
+                  << " ms (" << mb / (replay_ms / 1000.0) << " MB/s)" << std::endl;
+    }
+}
+
+TEST_F(PerformanceTest, RecordChecksumOverhead) {
+    const size_t num_records = 100000;
+    const size_t data_size = 1024;
+    const int num_rounds = 3;
+    
+    std::string data(data_size, '\0');
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i * 131 + 17);
+    }
+    
+    // CRC32C 자체 처리량 (하드웨어 vs 테이블 구현)
+    std::string block(64 * 1024 * 1024, 'C');
+    auto start = high_resolution_clock::now();
+    volatile uint32_t crc = Checksum::Crc32c(block);
+    auto end = high_resolution_clock::now();
+    double accelerated_s = duration_cast<microseconds>(end - start).count() / 1e6;
+    start = high_resolution_clock::now();
+    crc = Checksum::Crc32cPortable(block.data(), block.size());
+    end = high_resolution_clock::now();
+    double portable_s = duration_cast<microseconds>(end - start).count() / 1e6;
+    (void)crc;
+    
+    double mb = (num_records * data_size) / (1024.0 * 1024.0);
+    std::cout << "\n=== 레코드 체크섬 (CRC32C) 오버헤드 ===" << std::endl;
+    std::cout << "하드웨어 가속: " << (Checksum::IsHardwareAccelerated() ? "예" : "아니오") << std::endl;
+    std::cout << "CRC32C: " << 64.0 / accelerated_s << " MB/s, 테이블 구현: " << 64.0 / portable_s << " MB/s" << std::endl;
+    
+    // 체크섬 비활성/활성 저장소의 SaveMulti + Load 처리량 (라운드별 최선값)
+    double best_save_ms[2] = {1e12, 1e12};
+    double best_load_ms[2] = {1e12, 1e12};
+    for (int round = 0; round < num_rounds; ++round) {
+        for (int enabled = 0; enabled < 2; ++enabled) {
+            TestDirectoryGuard db_dir("perf_checksum_db");
+            StorageOptions options;
+            options.enable_checksums = enabled == 1;
+            GroupStorage storage(db_dir.GetPathString(), options);
+            ASSERT_TRUE(storage.Initialize());
+            std::string group_key = "checksum_group";
+            ASSERT_TRUE(storage.InitializeSession(group_key));
+            storage.SetBatchSize(1000);
+            
+            std::vector<std::pair<std::string, std::string>> entries(1000, {group_key, data});
+            start = high_resolution_clock::now();
+            for (size_t i = 0; i < num_records / entries.size(); ++i) {
+                ASSERT_TRUE(storage.SaveMulti(entries));
+            }
+            end = high_resolution_clock::now();
+            best_save_ms[enabled] = std::min(best_save_ms[enabled],
+                                             duration_cast<microseconds>(end - start).count() / 1000.0);
+            
+            start = high_resolution_clock::now();
+            auto values = storage.Load(group_key);
+            end = high_resolution_clock::now();
+            best_load_ms[enabled] = std::min(best_load_ms[enabled],
+                                             duration_cast<microseconds>(end - start).count() / 1000.0);
+            EXPECT_EQ(values.size(), num_records);
+            storage.Shutdown();
+        }
+    }
+    
+    std::cout << "레코드 수: " << num_records << ", 데이터 크기: " << mb << " MB" << std::endl;
+    std::cout << "SaveMulti: " << best_save_ms[0] << " ms -> " << best_save_ms[1] << " ms ("
+              << (best_save_ms[1] / best_save_ms[0] - 1.0) * 100.0 << "%)" << std::endl;
+    std::cout << "Load: " << best_load_ms[0] << " ms -> " << best_load_ms[1] << " ms ("
+              << (best_load_ms[1] / best_load_ms[0] - 1.0) * 100.0 << "%)" << std::endl;
+    
+    // 레코드당 CRC32C 4바이트 계산/검증이 처리 시간을 두 배로 만들지 않아야 함 (측정 편차 고려한 여유값)
+    EXPECT_LE(best_save_ms[1], best_save_ms[0] * 2.0);
+    EXPECT_LE(best_load_ms[1], best_load_ms[0] * 2.0);
+}
+
+namespace {
+
+// 가상 호출 비교용: MemoryBackend를 가상 인터페이스 뒤에 둔 백엔드 (IStorage와 같은 호출 구조)
+class IMemoryOps {
+public:
+    virtual ~IMemoryOps() = default;
+    virtual bool Put(std::string_view key, std::string_view value) = 0;
+    virtual bool Get(std::string_view key, std::string& value) = 0;
+    virtual bool Delete(std::string_view key) = 0;
+    virtual bool DeleteRange(std::string_view start_key, std::string_view end_key) = 0;
+    virtual void Scan(std::string_view lower, std::string_view upper,
+                      const std::function<bool(std::string_view, std::string_view)>& visit) = 0;
+};
+
+class MemoryOps : public IMemoryOps {
+public:
+    bool Put(std::string_view key, std::string_view value) override { return backend_.Put(key, value); }
+    bool Get(std::string_view key, std::string& value) override { return backend_.Get(key, value); }
+    bool Delete(std::string_view key) override { return backend_.Delete(key); }
+    bool DeleteRange(std::string_view start_key, std::string_view end_key) override {
+        return backend_.DeleteRange(start_key, end_key);
+    }
+    void Scan(std::string_view lower, std::string_view upper,
+              const std::function<bool(std::string_view, std::string_view)>& visit) override {
+        backend_.Scan(lower, upper, visit);
+    }
+
+private:
+    MemoryBackend backend_;
+};
+
+class VirtualMemoryBackend {
+public:
+    VirtualMemoryBackend() : ops_(std::make_unique<MemoryOps>()) {}
+    bool Put(std::string_view key, std::string_view value) { return ops_->Put(key, value); }
+    bool Get(std::string_view key, std::string& value) { return ops_->Get(key, value); }
+    bool Delete(std::string_view key) { return ops_->Delete(key); }
+    bool DeleteRange(std::string_view start_key, std::string_view end_key) {
+        return ops_->DeleteRange(start_key, end_key);
+    }
+    template <typename Visitor>
+    void Scan(std::string_view lower, std::string_view upper, Visitor&& visit) {
+        ops_->Scan(lower, upper, visit);
+    }
+    template <typename Fn>
+    bool Atomically(Fn&& fn) {
+        return fn();
+    }
+
+private:
+    std::unique_ptr<IMemoryOps> ops_;
+};
+
+template <typename Storage>
+void MeasureBasicGroupStorage(size_t num_records, const std::string& data, double& save_ns, double& load_ns) {
+    Storage storage;
+    storage.SetBatchSize(100);
+    storage.InitializeSession("basic_group");
+
+    auto start = high_resolution_clock::now();
+    for (size_t i = 0; i < num_records; ++i) {
+        storage.Save("basic_group", data);
+    }
+    auto end = high_resolution_clock::now();
+    save_ns = std::min(save_ns, duration_cast<nanoseconds>(end - start).count() / static_cast<double>(num_records));
+
+    start = high_resolution_clock::now();
+    auto values = storage.Load("basic_group");
+    end = high_resolution_clock::now();
+    load_ns = std::min(load_ns, duration_cast<nanoseconds>(end - start).count() / static_cast<double>(num_records));
+    EXPECT_EQ(values.size(), num_records);
+}
+
+} // anonymous namespace
+
+TEST_F(PerformanceTest, StaticDispatchCallOverhead) {
+    const size_t num_records = 500000;
+    const int num_rounds = 3;
+    const std::string data(16, 'S');
+    
+    // 같은 메모리 백엔드에서 정책 구성만 바꿔 호출 오버헤드 비교 (라운드별 최선값)
+    struct Config {
+        const char* name;
+        void (*measure)(size_t, const std::string&, double&, double&);
+        double save_ns = 1e12;
+        double load_ns = 1e12;
+    };
+    Config configs[] = {
+        {"가상 백엔드 + JSON + 뮤텍스",
+         &MeasureBasicGroupStorage<BasicGroupStorage<VirtualMemoryBackend, JsonMetadataCodec, MutexLockPolicy>>},
+        {"정적 백엔드 + JSON + 뮤텍스",
+         &MeasureBasicGroupStorage<BasicGroupStorage<MemoryBackend, JsonMetadataCodec, MutexLockPolicy>>},
+        {"정적 백엔드 + 바이너리 + 잠금 없음",
+         &MeasureBasicGroupStorage<BasicGroupStorage<MemoryBackend, BinaryMetadataCodec, NullLockPolicy>>},
+    };
+    
+    for (int round = 0; round < num_rounds; ++round) {
+        for (auto& config : configs) {
+            config.measure(num_records, data, config.save_ns, config.load_ns);
+        }
+    }
+    
+    std::cout << "\n=== 정책 기반 BasicGroupStorage 호출 오버헤드 (메모리 백엔드) ===" << std::endl;
+    std::cout << "레코드 수: " << num_records << ", 데이터 크기: " << data.size() << " bytes" << std::endl;
+    for (const auto& config : configs) {
+        std::cout << config.name << ": Save " << config.save_ns << " ns/op, Load "
+                  << config.load_ns << " ns/record" << std::endl;
+    }
+    std::cout << "가상 호출 제거 효과 (Save): " << configs[0].save_ns - configs[1].save_ns << " ns/op" << std::endl;
+    std::cout << "전체 정적 구성 효과 (Save): " << configs[0].save_ns - configs[2].save_ns << " ns/op" << std::endl;
+}
+
+TEST_F(PerformanceTest, KeyFormatVersusOstringstream) {
+    const int64_t num_keys = 2000000;
+    const std::string prefix = "bench_group:01ARZ3NDEKTSV4RRFFQ69G5FAV:01ARZ3NDEKTSV4RRFFQ69G5FAW:";
+    size_t checksum = 0;
+    
+    // 기존 경로: ostringstream + setfill/setw
+    auto start = high_resolution_clock::now();
+    for (int64_t i = 0; i < num_keys; ++i) {
+        std::ostringstream oss;
+        oss << prefix << std::setfill('0') << std::setw(20) << i;
+        checksum += oss.str().back();
+    }
+    auto end = high_resolution_clock::now();
+    double stream_ns = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(num_keys);
+    
+    // 테이블 기반 고정 폭 포맷 (키마다 새 문자열)
+    start = high_resolution_clock::now();
+    for (int64_t i = 0; i < num_keys; ++i) {
+        std::string key;
+        key.reserve(prefix.size() + KeyFormat::SEQUENCE_DIGITS);
+        key.append(prefix);
+        KeyFormat::AppendSequence(key, i);
+        checksum += key.back();
+    }
+    end = high_resolution_clock::now();
+    double kernel_ns = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(num_keys);
+    
+    // 미리 할당한 키 버퍼의 시퀀스 자리만 덮어쓰기
+    std::string buffer = prefix + std::string(KeyFormat::SEQUENCE_DIGITS, '0');
+    start = high_resolution_clock::now();
+    for (int64_t i = 0; i < num_keys; ++i) {
+        KeyFormat::FormatSequence(buffer.data() + prefix.size(), i);
+        checksum += buffer.back();
+    }
+    end = high_resolution_clock::now();
+    double inplace_ns = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(num_keys);
+    
+    // 파싱: from_chars 대비
+    std::string digits(KeyFormat::SEQUENCE_DIGITS, '0');
+    int64_t parsed_sum = 0;
+    start = high_resolution_clock::now();
+    for (int64_t i = 0; i < num_keys; ++i) {
+        KeyFormat::FormatSequence(digits.data(), i);
+        int64_t value = 0;
+        std::from_chars(digits.data(), digits.data() + digits.size(), value);
+        parsed_sum += value;
+    }
+    end = high_resolution_clock::now();
+    double from_chars_ns = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(num_keys);
+    
+    int64_t kernel_sum = 0;
+    start = high_resolution_clock::now();
+    for (int64_t i = 0; i < num_keys; ++i) {
+        KeyFormat::FormatSequence(digits.data(), i);
+        int64_t value = 0;
+        KeyFormat::ParseSequence(digits, value);
+        kernel_sum += value;
+    }
+    end = high_resolution_clock::now();
+    double parse_ns = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(num_keys);
+    EXPECT_EQ(parsed_sum, kernel_sum);
+    EXPECT_GT(checksum, 0u);
+    
+    std::cout << "\n=== 데이터 키 시퀀스 포맷/파싱 ===" << std::endl;
+    std::cout << "키 수: " << num_keys << std::endl;
+    std::cout << "ostringstream 키 생성: " << stream_ns << " ns/key" << std::endl;
+    std::cout << "KeyFormat 키 생성: " << kernel_ns << " ns/key (" << stream_ns / kernel_ns << "x)" << std::endl;
+    std::cout << "KeyFormat 버퍼 덮어쓰기: " << inplace_ns << " ns/key" << std::endl;
+    std::cout << "포맷 + from_chars: " << from_chars_ns << " ns/key, 포맷 + ParseSequence: "
+              << parse_ns << " ns/key" << std::endl;
+}
+
+TEST_F(PerformanceTest, MetadataStatusPrefilter) {
+    const size_t num_metadata = 200000;
+    
+    // 대부분 LOADED, 1%만 PENDING인 기존 저장소 메타데이터
+    std::vector<std::string> records;
+    records.reserve(num_metadata);
+    for (size_t i = 0; i < num_metadata; ++i) {
+        BatchMetadata metadata;
+        metadata.SetBatchId(ULID::GenerateMonotonic());
+        metadata.SetSequenceStart(static_cast<int64_t>(i * 100));
+        metadata.SetSequenceEnd(static_cast<int64_t>(i * 100 + 99));
+        metadata.SetCreatedAt(static_cast<int64_t>(ULID::Now()));
+        if (i % 100 != 0) {
+            metadata.SetStatus(BatchStatus::LOADED);
+            metadata.SetLoadedAt(static_cast<int64_t>(ULID::Now()));
+        }
+        records.push_back(metadata.toJson());
+    }
+    
+    // 기존 경로: 모든 레코드를 DOM 파싱 후 상태 확인
+    size_t dom_pending = 0;
+    auto start = high_resolution_clock::now();
+    for (const auto& record : records) {
+        BatchMetadata metadata;
+        metadata.fromJson(record);
+        if (metadata.GetStatus() == BatchStatus::PENDING) {
+            dom_pending++;
+        }
+    }
+    auto end = high_resolution_clock::now();
+    double dom_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    
+    // 사전 필터: 원시 바이트에서 status/sequence_start만 확인
+    size_t probe_pending = 0;
+    int64_t sequence_sum = 0;
+    start = high_resolution_clock::now();
+    for (const auto& record : records) {
+        BatchStatus status;
+        int64_t sequence_start = 0;
+        if (MetadataScan::ProbeStatus(record, status) && status == BatchStatus::PENDING &&
+            MetadataScan::ProbeInt64(record, "sequence_start", sequence_start)) {
+            probe_pending++;
+            sequence_sum += sequence_start;
+        }
+    }
+    end = high_resolution_clock::now();
+    double probe_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    EXPECT_EQ(probe_pending, dom_pending);
+    EXPECT_GT(sequence_sum, 0);
+    
+    // 전체 필드 디코딩 (Load 경로)
+    size_t decoded = 0;
+    start = high_resolution_clock::now();
+    for (const auto& record : records) {
+        BatchMetadata metadata;
+        if (MetadataScan::Decode(record, metadata)) {
+            decoded++;
+        }
+    }
+    end = high_resolution_clock::now();
+    double decode_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    EXPECT_EQ(decoded, num_metadata);
+    
+    // 저장소 경로: LOADED 배치가 쌓인 그룹에서 남은 PENDING 배치 LoadBatch
+    std::string group_key = "prefilter_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(1);
+    std::vector<std::pair<std::string, std::string>> entries(1000, {group_key, "x"});
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(storage_->SaveMulti(entries));
+    }
+    ASSERT_EQ(storage_->LoadBatch(group_key, 19990).size(), 19990u);
+    start = high_resolution_clock::now();
+    auto remaining = storage_->LoadBatch(group_key, 100);
+    end = high_resolution_clock::now();
+    double load_batch_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    EXPECT_EQ(remaining.size(), 10u);
+    
+    std::cout << "\n=== 메타데이터 상태 사전 필터 (" << MetadataScan::VectorIsa() << ") ===" << std::endl;
+    std::cout << "메타데이터 수: " << num_metadata << " (PENDING " << dom_pending << ")" << std::endl;
+    std::cout << "DOM 파싱: " << dom_ms << " ms, 사전 필터: " << probe_ms << " ms ("
+              << dom_ms / probe_ms << "x), 원시 디코딩: " << decode_ms << " ms ("
+              << dom_ms / decode_ms << "x)" << std::endl;
+    std::cout << "LOADED 19990개 + PENDING 10개 그룹의 LoadBatch: " << load_batch_ms << " ms" << std::endl;
+}
+
+TEST_F(PerformanceTest, ArenaBatchLoadVersusVector) {
+    const size_t num_batches = 200;
+    const size_t batch_size = 100;
+    const std::string payload(256, 'p');
+    
+    // 같은 데이터를 가진 두 그룹 준비
+    std::string vector_group = "vector_load_group";
+    std::string arena_group = "arena_load_group";
+    storage_->SetBatchSize(batch_size);
+    for (const auto& group_key : {vector_group, arena_group}) {
+        ASSERT_TRUE(storage_->InitializeSession(group_key));
+        std::vector<std::pair<std::string, std::string>> entries(batch_size, {group_key, payload});
+        for (size_t i = 0; i < num_batches; ++i) {
+            ASSERT_TRUE(storage_->SaveMulti(entries));
+        }
+    }
+    
+    // 기존 경로: 배치마다 vector<string> 결과 생성 후 해제
+    size_t vector_bytes = 0;
+    size_t vector_batches = 0;
+    auto start = high_resolution_clock::now();
+    while (true) {
+        auto batches = storage_->LoadBatch(vector_group, 1);
+        if (batches.empty()) {
+            break;
+        }
+        for (const auto& data : batches[0].data) {
+            vector_bytes += data.size();
+        }
+        vector_batches++;
+    }
+    auto end = high_resolution_clock::now();
+    double vector_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    
+    // 아레나 경로: 소비자 결과 하나를 Reset하며 재사용
+    size_t arena_bytes = 0;
+    size_t arena_batches = 0;
+    ArenaBatchLoadResult result;
+    start = high_resolution_clock::now();
+    while (storage_->LoadBatch(arena_group, result)) {
+        for (std::string_view data : result.data) {
+            arena_bytes += data.size();
+        }
+        arena_batches++;
+    }
+    end = high_resolution_clock::now();
+    double arena_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    
+    EXPECT_EQ(vector_batches, num_batches);
+    EXPECT_EQ(arena_batches, num_batches);
+    EXPECT_EQ(vector_bytes, num_batches * batch_size * payload.size());
+    EXPECT_EQ(arena_bytes, vector_bytes);
+    
+    std::cout << "\n=== 아레나 배치 로드 vs vector<string> ===" << std::endl;
+    std::cout << "배치: " << num_batches << " x " << batch_size << " x " << payload.size() << "B" << std::endl;
+    std::cout << "vector<string>: " << vector_ms << " ms, 아레나: " << arena_ms << " ms ("
+              << vector_ms / arena_ms << "x), 아레나 용량: " << result.data.Capacity() << " bytes" << std::endl;
+}
+
+TEST_F(PerformanceTest, IdleGroupEvictionBoundsRss) {
+    const size_t num_groups = 1000000;
+    const size_t wave_size = 50000;
+    const size_t touch_samples = 10000;
+    const size_t budget_capacity = 64 * 1024 * 1024;
+    // 그룹 레지스트리(그룹 이름 집합)는 축출 대상이 아니므로 그룹당 허용량
+    const uint64_t registry_bytes_per_group = 128;
+    const uint64_t rss_slack = 96 * 1024 * 1024;
+    
+    uint64_t baseline_rss = GetResidentSetSize();
+    if (baseline_rss == 0) {
+        GTEST_SKIP() << "RSS 측정 미지원 환경";
+    }
+    
+    // RocksDB 메모리는 공유 예산으로 제한하여 그룹 상태 메모리만 드러나도록 함
+    storage_->Shutdown();
+    auto budget = MemoryBudget::Create(budget_capacity, 0.5);
+    StorageOptions options;
+    options.memory_budget = budget;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    auto group_name = [](size_t index) { return "tenant_" + std::to_string(index); };
+    
+    // 웨이브 단위로 그룹을 만들고, 웨이브가 끝난 그룹은 유휴로 간주하여 축출
+    std::vector<std::pair<std::string, std::string>> entries;
+    entries.reserve(wave_size);
+    size_t peak_resident = 0;
+    uint64_t peak_rss = baseline_rss;
+    auto start = high_resolution_clock::now();
+    for (size_t wave_start = 0; wave_start < num_groups; wave_start += wave_size) {
+        entries.clear();
+        for (size_t i = wave_start; i < wave_start + wave_size; ++i) {
+            entries.emplace_back(group_name(i), "x");
+        }
+        ASSERT_TRUE(storage_->SaveMulti(entries));
+        peak_resident = std::max(peak_resident, storage_->GetResidentGroupCount());
+        ASSERT_EQ(storage_->EvictIdleGroups(0), wave_size);
+        peak_rss = std::max(peak_rss, GetResidentSetSize());
+    }
+    auto end = high_resolution_clock::now();
+    double create_ms = duration_cast<milliseconds>(end - start).count();
+    
+    // 축출된 그룹의 첫 접근(저장된 상태 복원 + Save)과 두 번째 접근 지연 비교
+    // 7919는 그룹 수와 서로소이므로 표본 그룹은 모두 다름
+    std::vector<double> first_touch_us;
+    std::vector<double> warm_touch_us;
+    first_touch_us.reserve(touch_samples);
+    warm_touch_us.reserve(touch_samples);
+    for (size_t k = 0; k < touch_samples; ++k) {
+        std::string group_key = group_name((k * 7919) % num_groups);
+        auto touch_start = high_resolution_clock::now();
+        ASSERT_TRUE(storage_->Save(group_key, "y"));
+        auto touch_mid = high_resolution_clock::now();
+        ASSERT_TRUE(storage_->Save(group_key, "z"));
+        auto touch_end = high_resolution_clock::now();
+        first_touch_us.push_back(duration_cast<nanoseconds>(touch_mid - touch_start).count() / 1000.0);
+        warm_touch_us.push_back(duration_cast<nanoseconds>(touch_end - touch_mid).count() / 1000.0);
+    }
+    std::sort(first_touch_us.begin(), first_touch_us.end());
+    std::sort(warm_touch_us.begin(), warm_touch_us.end());
+    
+    // 복원된 그룹은 같은 세션에서 순서대로 이어짐
+    auto data = storage_->Load(group_name(0));
+    ASSERT_EQ(data.size(), 3u);
+    EXPECT_EQ(data[0], "x");
+    EXPECT_EQ(data[1], "y");
+    EXPECT_EQ(data[2], "z");
+    
+    uint64_t rss_growth = peak_rss - baseline_rss;
+    std::cout << "\n=== 유휴 그룹 축출 (" << num_groups << "개 그룹) ===" << std::endl;
+    std::cout << "그룹 생성 + 축출: " << create_ms << " ms, 최대 상주 그룹: " << peak_resident << std::endl;
+    std::cout << "RSS 증가량 (최대): " << rss_growth / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "첫 접근 p50/p99: " << first_touch_us[touch_samples / 2] << " / "
+              << first_touch_us[touch_samples * 99 / 100] << " us" << std::endl;
+    std::cout << "두 번째 접근 p50/p99: " << warm_touch_us[touch_samples / 2] << " / "
+              << warm_touch_us[touch_samples * 99 / 100] << " us" << std::endl;
+    
+    EXPECT_LE(peak_resident, wave_size);
+    EXPECT_LE(rss_growth, budget_capacity + num_groups * registry_bytes_per_group + rss_slack);
+}
+
+TEST_F(PerformanceTest, ParallelLoadScaling) {
+    const size_t num_batches = 256;
+    const size_t batch_size = 64;
+    const size_t data_size = 4096;
+    
+    // 체크섬 검증까지 포함한 읽기 경로 측정
+    storage_->Shutdown();
+    StorageOptions options;
+    options.enable_checksums = true;
+    storage_ = std::make_unique<GroupStorage>(test_dir_guard_->GetPathString(), options);
+    ASSERT_TRUE(storage_->Initialize());
+    
+    std::string group_key = "parallel_load_group";
+    ASSERT_TRUE(storage_->InitializeSession(group_key));
+    storage_->SetBatchSize(batch_size);
+    std::vector<std::pair<std::string, std::string>> entries;
+    for (size_t i = 0; i < batch_size; ++i) {
+        entries.emplace_back(group_key, std::string(data_size, static_cast<char>('a' + i % 26)));
+    }
+    for (size_t i = 0; i < num_batches; ++i) {
+        ASSERT_TRUE(storage_->SaveMulti(entries));
+    }
+    ASSERT_TRUE(storage_->Flush());
+    
+    const double total_mb = static_cast<double>(num_batches * batch_size * data_size) / (1024 * 1024);
+    std::vector<std::string> expected = storage_->Load(group_key, 1);
+    ASSERT_EQ(expected.size(), num_batches * batch_size);
+    
+    std::cout << "\n=== 병렬 Load 확장성 (" << num_batches << " 배치, " << total_mb << " MB) ===" << std::endl;
+    double single_thread_ms = 0;
+    for (size_t threads : {1, 2, 4, 8, 16}) {
+        auto start = high_resolution_clock::now();
+        auto data = storage_->Load(group_key, threads);
+        auto end = high_resolution_clock::now();
+        double elapsed_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+        if (threads == 1) {
+            single_thread_ms = elapsed_ms;
+        }
+        
+        ASSERT_EQ(data.size(), expected.size());
+        EXPECT_TRUE(data == expected) << "threads=" << threads;
+        std::cout << threads << " 스레드: " << elapsed_ms << " ms, " << total_mb * 1000.0 / elapsed_ms
+                  << " MB/s (" << single_thread_ms / elapsed_ms << "x)" << std::endl;
+    }
+}
+
+TEST_F(PerformanceTest, AcknowledgeUpToVersusPerBatch) {
+    const size_t num_batches = 1000;
+    const size_t batch_size = 10;
+    storage_->SetBatchSize(batch_size);
+    
+    std::string per_batch_group = "per_batch_ack_group";
+    std::string cumulative_group = "cumulative_ack_group";
+    for (const auto& group_key : {per_batch_group, cumulative_group}) {
+        ASSERT_TRUE(storage_->InitializeSession(group_key));
+        std::vector<std::pair<std::string, std::string>> entries(batch_size * 100, {group_key, "payload"});
+        for (size_t i = 0; i < num_batches / 100; ++i) {
+            ASSERT_TRUE(storage_->SaveMulti(entries));
+        }
+    }
+    
+    // 기존 경로: 배치마다 LoadBatch 결과의 ID로 ACK (배치당 커밋 1회)
+    auto batches = storage_->LoadBatch(per_batch_group, num_batches);
+    ASSERT_EQ(batches.size(), num_batches);
+    auto start = high_resolution_clock::now();
+    for (const auto& batch : batches) {
+        ASSERT_TRUE(storage_->AcknowledgeBatch(per_batch_group, batch.batch_id));
+    }
+    auto end = high_resolution_clock::now();
+    double per_batch_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    
+    // 누적 ACK: 범위 삭제 + 워터마크를 한 번에 커밋
+    start = high_resolution_clock::now();
+    ASSERT_TRUE(storage_->AcknowledgeUpTo(cumulative_group, static_cast<int64_t>(num_batches * batch_size) - 1));
+    end = high_resolution_clock::now();
+    double cumulative_ms = duration_cast<microseconds>(end - start).count() / 1000.0;
+    
+    EXPECT_TRUE(storage_->Load(per_batch_group).empty());
+    EXPECT_TRUE(storage_->Load(cumulative_group).empty());
+    
+    std::cout << "\n=== 누적 ACK vs 배치별 ACK (" << num_batches << " 배치) ===" << std::endl;
+    std::cout << "배치별 AcknowledgeBatch: " << per_batch_ms << " ms" << std::endl;
+    std::cout << "AcknowledgeUpTo: " << cumulative_ms << " ms (" << per_batch_ms / cumulative_ms << "x)" << std::endl;
+}
+
 // ============================================================================
 // 복잡한 동시성 테스트
 // ============================================================================
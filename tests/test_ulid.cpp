@@ -72,3 +72,16 @@ TEST(ULIDTest, LexicographicOrder) {
     EXPECT_EQ(ulids, sorted_ulids);
 }
 
+
+TEST(ULIDTest, MonotonicWithinMillisecond) {
+    // 같은 밀리초 내에서도 생성 순서와 사전순이 일치해야 함
+    std::vector<std::string> ulids;
+    for (int i = 0; i < 10000; ++i) {
+        ulids.push_back(ULID::GenerateMonotonic());
+    }
+    
+    for (size_t i = 1; i < ulids.size(); ++i) {
+        EXPECT_TRUE(ULID::IsValid(ulids[i]));
+        ASSERT_LT(ulids[i - 1], ulids[i]);
+    }
+}
@@ -1,11 +1,17 @@
 #pragma once
 
 #include <filesystem>
+#include <fstream>
 #include <string>
 #include <random>
 #include <chrono>
 #include <thread>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace durastash {
 namespace test_utils {
 
@@ -79,6 +85,65 @@ inline bool RemoveTestDirectory(const std::filesystem::path& path, int max_retri
     return false;
 }
 
+/**
+ * 디렉토리 전체 크기 계산 (하위 디렉토리 포함, 바이트)
+ */
+inline uint64_t GetDirectorySize(const std::filesystem::path& path) {
+    uint64_t total = 0;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(path, ec)) {
+        if (entry.is_regular_file(ec)) {
+            total += entry.file_size(ec);
+        }
+    }
+    return total;
+}
+
+/**
+ * 현재 프로세스의 상주 메모리 크기 (RSS, 바이트)
+ * Linux(/proc/self/statm)에서만 지원하며, 미지원 환경에서는 0 반환
+ */
+inline uint64_t GetResidentSetSize() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    uint64_t total_pages = 0;
+    uint64_t resident_pages = 0;
+    if (!(statm >> total_pages >> resident_pages)) {
+        return 0;
+    }
+    return resident_pages * static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+/**
+ * 디렉토리 내 파일을 OS 페이지 캐시에서 제거 (콜드 캐시 측정용)
+ * POSIX 환경에서만 동작하며, 더티 페이지는 제거되지 않으므로 호출 전에 저장소를 닫아야 함
+ * @return 페이지 캐시 제거를 지원하면 true
+ */
+inline bool EvictFromPageCache(const std::filesystem::path& path) {
+#if defined(_WIN32) || !defined(POSIX_FADV_DONTNEED)
+    (void)path;
+    return false;
+#else
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(path, ec)) {
+        if (!entry.is_regular_file(ec)) {
+            continue;
+        }
+        int fd = ::open(entry.path().c_str(), O_RDONLY);
+        if (fd < 0) {
+            continue;
+        }
+        ::fdatasync(fd);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+    return true;
+#endif
+}
+
 /**
  * 테스트 디렉토리 정리 헬퍼 클래스
  * RAII 패턴으로 테스트 종료 시 자동 정리 보장